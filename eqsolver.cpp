@@ -9,6 +9,21 @@
 	- 100% integer arithmetic, no FPU needed
 	- Detects Infinite Solutions & No Solutions
 	- Detects Overflow
+	- Computes Determinant & Rank Using Fraction-Free Elimination
+	- Stores & Solves Banded Systems In O(N*Bandwidth^2)
+	- Stores Symmetric Systems As Upper Triangle, Solves Them By Fraction-Free LDL'
+	- Solves Toeplitz & Vandermonde Systems From Their Generators In O(N^2)
+	- Solves Independent Subsystems Concurrently
+	- Solves Reducible Systems Block By Block, Independent Blocks In Parallel
+	- Eliminates Large Dense Systems In Cache-Sized Tiles, Tiles In Parallel
+	- Optionally Keeps All Matrices In One Huge Page Arena
+	- Solves Systems Larger Than Memory Out Of Core, From A Memory-Mapped File
+	- Allocates Through A Pluggable Allocator, Accounts For Memory Used
+	- Checkpoints Long Solves, Resumes Them After Interruption
+	- Keeps The Unaltered Matrix In Its 16-bit Input Form
+	- Loads Whole Systems From Contiguous 16, 32 & 64-bit Arrays
+	- Takes 32 & 64-bit Integers & Fractions, Held In The Narrowest Form That Fits
+	- Stores & Solves Sparse Systems Of Millions Of Equations, 64-bit Indexed
   
 	Requirements:
 	- The number of equations and unknowns submitted to the object
@@ -17,1060 +32,9406 @@
 	must be 100% integer-based; floating point calculation
 	IS NOT SUPPORTED in this module.
 	- The maximum number of simulatenous equations (and thus unknowns)
-	this module supports is 65535.
+	this module supports is 65535, except in sparse storage
+	(setSparseSystem()), which is only limited by memory.
+	- GCC builds (GCC_BUILD defined) must link with -lpthread.
 */
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <memory.h>
 #include "eqsolver.h"
 
-/*	The purpose of this function is to allocate and zero-initialize
-	the memory required to store the N+1xN matrix coefficients. It 
-	allocates space for an "original" matrix which will be unaltered,
-	as well as a working copy. The original matrix is located by the
-	member variable originalCoefficient. The altered matrix is located
-	by the member variable coefficient.
+/* Threads, Used To Solve Independent Subsystems & Tiles Concurrently */
+/* Different Compilers Use Different Threading Mechanisms */
+
+/* GCC / G++ (POSIX Threads) */
+#ifdef GCC_BUILD
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+typedef pthread_t THREAD_HANDLE;
+typedef pthread_mutex_t THREAD_LOCK;
+#define THREAD_ROUTINE void *
+#define THREAD_RETURN return NULL
+typedef void *(*THREAD_FUNCTION)(void *parameter);
+
+/* Visual C++ 6.0 (Win32) */
+#else
+#include <windows.h>
+#include <io.h>
+typedef HANDLE THREAD_HANDLE;
+typedef CRITICAL_SECTION THREAD_LOCK;
+#define THREAD_ROUTINE DWORD WINAPI
+#define THREAD_RETURN return 0
+typedef LPTHREAD_START_ROUTINE THREAD_FUNCTION;
+#endif
+
+/* Lock Operations */
+static void createLock(THREAD_LOCK *lock)
+{
+#ifdef GCC_BUILD
+	pthread_mutex_init(lock, NULL);
+#else
+	InitializeCriticalSection(lock);
+#endif
+}
 
-	Parameters: 
-		count - Unsigned 16-bit value between 0-65536 which represents
-				the number of simultaneous equations to solve.
-	Returns:
-		1 on success
-		0 in case of an error (such as memory allocation errors)
-*/
-unsigned int eqsolver::setSystemEqCount(unsigned short int count)
+static void destroyLock(THREAD_LOCK *lock)
 {
-	unsigned int i,j;	/* Loop Counter */
-	
-	/* No Need To Allocate Space, Empty System */
-	if(count == 0)
-		return 1;
-	
-	eqCount = count;	/* Store # Of Simulatenous Equations In System */
-	
-	/* Allocate Array Of Matrix Row Pointers */
-	coefficient = (struct fraction **) malloc(count * sizeof(struct fraction *));
-	originalCoefficient = (struct fraction **) malloc(count * sizeof(struct fraction *));
+#ifdef GCC_BUILD
+	pthread_mutex_destroy(lock);
+#else
+	DeleteCriticalSection(lock);
+#endif
+}
 
-	/* Allocate Array Of Fractions For Solution Storage*/
-	solutionCoefficient = (struct fraction *) malloc(count * sizeof(struct fraction));
+static void acquireLock(THREAD_LOCK *lock)
+{
+#ifdef GCC_BUILD
+	pthread_mutex_lock(lock);
+#else
+	EnterCriticalSection(lock);
+#endif
+}
 
-	/* Check For Memory Allocation Error */
-	if((coefficient == NULL) || (originalCoefficient == NULL) || (solutionCoefficient == NULL))
-		return 0;	/* System Most Likely Crashed At This Point */
-					/* Clean-up Is Not Necessary, Reboot Is In Order */
-	
-	/* Zero Initialize Solution Array */
-	for(i=0; i<count; i++)
-	{
-		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
-		solutionCoefficient[i].sign = 0;
+static void releaseLock(THREAD_LOCK *lock)
+{
+#ifdef GCC_BUILD
+	pthread_mutex_unlock(lock);
+#else
+	LeaveCriticalSection(lock);
+#endif
+}
 
-	}
-	/* Allocate & Zero Initialize Row Coefficients */
-	for(i=0; i<count; i++)
-	{
-		coefficient[i] = (struct fraction *) malloc((count+1) * sizeof(struct fraction));
-		originalCoefficient[i] = (struct fraction *) malloc((count+1) * sizeof(struct fraction));
-		
-		/* Check For Memory Allocation Error */
-		if((coefficient[i] == NULL) || (originalCoefficient[i] == NULL))
-			return 0;	/* Review Explanation Above */
+/* Gives Up The Processor While Waiting For Work */
+static void yieldThread(void)
+{
+#ifdef GCC_BUILD
+	sched_yield();
+#else
+	Sleep(0);
+#endif
+}
 
-		/* Zero-Init Memory */
-		for(j=0; j<=count; j++)
-		{
-			coefficient[i][j].numerator = coefficient[i][j].denominator = 0;
-			originalCoefficient[i][j].numerator = originalCoefficient[i][j].denominator = 0;
-			coefficient[i][j].sign = originalCoefficient[i][j].sign = 0;
-		}
-	}
+/* Memory, Drawn From The Allocator Of A memoryAccount */
 
-	return 1;	/* Signals No Error */
+/* Each Block Starts With Its Size, So Releases Can Be Accounted */
+union memoryHeader
+{
+	size_t size;	/* Bytes, Header Included */
+	UINT64 align;	/* Keeps Blocks Aligned For 64-bit Data */
+	double alignDouble;
+};
+
+/* Account Lock, Only Present While Threads Run (See shareAccount()) */
+static void lockAccount(struct memoryAccount *account)
+{
+	if(account->lock != NULL)
+		acquireLock((THREAD_LOCK *) account->lock);
 }
 
-/*	The purpose of this function is to set the specified matrix
-	coefficient (in row,column order) to the specified value. This
-	value may be any number between -32768 to 32767 inclusive.
+static void unlockAccount(struct memoryAccount *account)
+{
+	if(account->lock != NULL)
+		releaseLock((THREAD_LOCK *) account->lock);
+}
+
+/*	The purpose of this function is to guard an account with a lock
+	before threads are started which may allocate through it. The
+	first (outermost) caller installs the lock, nested callers find it
+	in place.
 
 	Parameters: 
-		row - matrix row # (starting at 1)
-		column - matrix column # (starting at 1)
-		value - value at which to set the specified coefficient
+		account - account to guard
+		lock - storage for the lock, valid until unshareAccount()
 
 	Returns:
-		In case of error (out of bound matrix positioning), the
-		function simply returns without altering any memory.
+		1 if the lock was installed (unshareAccount() must follow once
+		the threads are joined), 0 if the account was already guarded.
 */
-void eqsolver::setCoefficient(unsigned short int row, unsigned short int column, short int value)
+static int shareAccount(struct memoryAccount *account, THREAD_LOCK *lock)
 {
-	/* Verify Matrix Bounds */
-	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
-		return;	/* Out Of Bounds, Simply Return */
+	if(account->lock != NULL)
+		return 0;
 
-	/* Set Specified Coefficient Numerator To Specified Value */
-	if(value < 0)
-	{
-		coefficient[(row-1)][(column-1)].numerator = (unsigned int) abs((int)value);
-		coefficient[(row-1)][(column-1)].sign = 1;
-		originalCoefficient[(row-1)][(column-1)].numerator = (unsigned int) abs((int)value);
-		originalCoefficient[(row-1)][(column-1)].sign = 1;	
-	}
-	else
-	{
-		coefficient[(row-1)][(column-1)].numerator = (unsigned int) value;	/* Cast To 32-bits */
-		coefficient[(row-1)][(column-1)].sign = 0;
-		originalCoefficient[(row-1)][(column-1)].numerator = (unsigned int) value;
-		originalCoefficient[(row-1)][(column-1)].sign = 0;
-	}
+	createLock(lock);
+	account->lock = lock;
 
-	/* Set Denominator */
-	if(value == 0)	/* Value Will Be 0/0, not 0/1 */
+	return 1;
+}
+
+static void unshareAccount(struct memoryAccount *account)
+{
+	destroyLock((THREAD_LOCK *) account->lock);
+	account->lock = NULL;
+}
+
+/*	The purpose of this function is to update the usage of an account.
+	The caller holds the account lock.
+
+	Parameters: 
+		account - account to update
+		size - bytes allocated or released
+		allocated - 1 = allocated, 0 = released
+
+	Returns:
+		None
+*/
+static void countMemory(struct memoryAccount *account, UINT64 size, int allocated)
+{
+	if(allocated)
 	{
-		coefficient[(row-1)][(column-1)].denominator = 0;
-		originalCoefficient[(row-1)][(column-1)].denominator = 0;
+		account->inUse += size;
+		account->allocations++;
+		if(account->inUse > account->peak)
+			account->peak = account->inUse;
 	}
 	else
-	{
-		coefficient[(row-1)][(column-1)].denominator = 1;
-		originalCoefficient[(row-1)][(column-1)].denominator = 1;
-	}
+		account->inUse -= size;
 }
 
-/*	The purpose of this function is to set the specified matrix
-	coefficient (in row,column order) to the specified value. This
-	value may be any number between -32768 to 32767 inclusive. In 
-	this setCoefficient() variation, both the numerator & denominator
-	can be set.
+/*	The purpose of this function is to allocate memory from the
+	allocator of an account (malloc() if none was set) and charge it
+	to the account.
 
 	Parameters: 
-		row - matrix row # (starting at 1)
-		column - matrix column # (starting at 1)
-		numerator - value at which to set the specified coefficient numerator
-		denominator - value at which to set the specified coefficient denominator
+		account - account to charge
+		size - bytes needed
 
 	Returns:
-		In case of error (out of bound matrix positioning), the
-		function simply returns without altering any memory.
+		The memory, NULL if it could not be allocated.
 */
-void eqsolver::setCoefficientFraction(unsigned short int row, unsigned short int column, short int numerator, short int denominator)	/* Sets Coefficient Value In Fraction Form */
+static void *allocateFrom(struct memoryAccount *account, size_t size)
 {
-		/* Verify Matrix Bounds */
-	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
-		return;	/* Out Of Bounds, Simply Return */
+	union memoryHeader *block;
+	size_t total;
 
-	/* Set Specified Coefficient Numerator To Specified Value */
-	coefficient[(row-1)][(column-1)].numerator = (unsigned int) abs((int)numerator);
-	originalCoefficient[(row-1)][(column-1)].numerator = (unsigned int) abs((int)numerator);
-	
-	/* Set Denominator */
-	if(denominator == 0)	/* Value Will Be 0/0 (Prevents Division By Zero */
-	{
-		coefficient[(row-1)][(column-1)].numerator = 0;
-		originalCoefficient[(row-1)][(column-1)].numerator = 0;
-		coefficient[(row-1)][(column-1)].denominator = 0;
-		originalCoefficient[(row-1)][(column-1)].denominator = 0;
-	}
-	else
-	{
-		coefficient[(row-1)][(column-1)].denominator = (unsigned int) abs((int)denominator);
-		originalCoefficient[(row-1)][(column-1)].denominator = (unsigned int) abs((int)denominator);
-	}
+	total = size + sizeof(union memoryHeader);
+	if(total < size)
+		return NULL;	/* Size Wraps Around */
 
-	/* Set Sign */
-	if(numerator < 0)
-	{
-		if(denominator < 0)
-		{
-			coefficient[(row-1)][(column-1)].sign = 0;
-			originalCoefficient[(row-1)][(column-1)].sign = 0;
-		}
-		else
-		{
-			coefficient[(row-1)][(column-1)].sign = 1;
-			originalCoefficient[(row-1)][(column-1)].sign = 1;
-		}
-	}
+	lockAccount(account);
+	if(account->allocator.allocate != NULL)
+		block = (union memoryHeader *) account->allocator.allocate(account->allocator.context, total);
 	else
+		block = (union memoryHeader *) malloc(total);
+	if(block != NULL)
 	{
-		if(denominator < 0)
-		{
-			coefficient[(row-1)][(column-1)].sign = 1;
-			originalCoefficient[(row-1)][(column-1)].sign = 1;
-		}
-		else
-		{
-			coefficient[(row-1)][(column-1)].sign = 0;
-			originalCoefficient[(row-1)][(column-1)].sign = 0;
-		}
+		block->size = total;
+		countMemory(account, total, 1);
 	}
+	unlockAccount(account);
+
+	return (block != NULL) ? (block+1) : NULL;
 }
 
-/*	The purpose of this function is to retrieve the value of the
-	specified unaltered matrix coefficient (returned in fraction form).
+/*	The purpose of this function is to return memory obtained by
+	allocateFrom() or reallocateFrom() to the allocator it came from.
 
 	Parameters: 
-		row - matrix row # (starting at 1)
-		column - matrix column # (starting at 1)
-		coefficientValue - reference to an integer		
+		account - account it was charged to
+		pointer - the memory (NULL is ignored)
 
 	Returns:
-		In case of error (out of bound matrix positioning), the
-		function simply returns 0. Otherwise the value is returned.
+		None
 */
-int eqsolver::getOriginalMatrixCoefficient(unsigned short int row, unsigned short int column)
+static void releaseTo(struct memoryAccount *account, void *pointer)
 {
-	int coefficientValue;
-	
-	/* Verify Matrix Bounds */
-	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
-		return 0;	/* Out Of Bounds, Simply Return, Note coefficientValue remains unchanged */
-	
-	coefficientValue = originalCoefficient[(row-1)][(column-1)].numerator;
-	
-	if(originalCoefficient[(row-1)][(column-1)].sign == 1)
-		coefficientValue = coefficientValue * -1;
+	union memoryHeader *block;
 
-	return coefficientValue;
+	if(pointer == NULL)
+		return;
+
+	block = ((union memoryHeader *) pointer) - 1;
+
+	lockAccount(account);
+	countMemory(account, block->size, 0);
+	if(account->allocator.allocate != NULL)
+		account->allocator.release(account->allocator.context, block, block->size);
+	else
+		free(block);
+	unlockAccount(account);
 }
 
-/* Same As Above, Slightly Modified */
-void eqsolver::getOriginalMatrixCoefficientFraction(unsigned int row, unsigned short int column,
-												  int *numerator, int *denominator)
-{	
-	/* Verify Matrix Bounds */
-	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+/*	The purpose of this function is to resize memory obtained by
+	allocateFrom(), keeping its contents as realloc() does. Without an
+	allocator hook realloc() itself is used, so blocks may grow in
+	place; otherwise the contents move to a new block.
+
+	Parameters: 
+		account - account it was charged to
+		pointer - the memory (NULL allocates)
+		size - bytes needed
+
+	Returns:
+		The memory, NULL if it could not be resized (pointer is then
+		left as it was).
+*/
+static void *reallocateFrom(struct memoryAccount *account, void *pointer, size_t size)
+{
+	union memoryHeader *block, *resized;
+	size_t total, previous;
+	void *moved;
+
+	if(pointer == NULL)
+		return allocateFrom(account, size);
+
+	total = size + sizeof(union memoryHeader);
+	if(total < size)
+		return NULL;	/* Size Wraps Around */
+
+	block = ((union memoryHeader *) pointer) - 1;
+	previous = block->size;
+
+	if(account->allocator.allocate == NULL)
 	{
-		*numerator = *denominator = 0;	
-		return;	/* Out Of Bounds, Simply Return, Note coefficientValue remains unchanged */
+		lockAccount(account);
+		resized = (union memoryHeader *) realloc(block, total);
+		if(resized != NULL)
+		{
+			resized->size = total;
+			countMemory(account, previous, 0);
+			countMemory(account, total, 1);
+		}
+		unlockAccount(account);
+
+		return (resized != NULL) ? (resized+1) : NULL;
 	}
 
-	*numerator = originalCoefficient[(row-1)][(column-1)].numerator;
-	
-	if(originalCoefficient[(row-1)][(column-1)].sign == 1)
-		*numerator = *numerator * -1;
+	moved = allocateFrom(account, size);
+	if(moved == NULL)
+		return NULL;
+	memcpy(moved, pointer, ((previous < total) ? previous : total) - sizeof(union memoryHeader));
+	releaseTo(account, pointer);
 
-	*denominator = originalCoefficient[(row-1)][(column-1)].denominator;
+	return moved;
 }
 
-/*	The purpose of this function is to retrieve the value of the
-	specified altered matrix coefficient (returned in fraction form).
+/* Processor Affinity: Linux Pins Worker Threads, Elsewhere They Float */
+#if defined(GCC_BUILD) && defined(__linux__)
+typedef cpu_set_t THREAD_AFFINITY;
+#else
+typedef int THREAD_AFFINITY;
+#endif
+
+/*	The purpose of this function is to pin the calling thread to one
+	processor, the same one for the same worker # every time, so the
+	memory a worker touches first stays on its NUMA node and the
+	worker stays next to it.
 
 	Parameters: 
-		row - matrix row # (starting at 1)
-		column - matrix column # (starting at 1)
-		coefficientValue - reference to fraction structure (stores result)		
+		worker - worker #
+		saved - receives the thread's previous affinity
 
 	Returns:
-		In case of error (out of bound matrix positioning), the
-		function simply returns.
+		None
 */
-void eqsolver::getAlteredMatrixCoefficient(unsigned short row, unsigned short column, struct fraction &coefficientValue)
+static void pinThread(unsigned int worker, THREAD_AFFINITY *saved)
 {
-	/* Verify Matrix Bounds */
-	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
-		return;	/* Out Of Bounds, Simply Return */
-	
-	coefficientValue.numerator = coefficient[(row-1)][(column-1)].numerator;
-	coefficientValue.denominator = coefficient[(row-1)][(column-1)].denominator;
-	coefficientValue.sign = coefficient[(row-1)][(column-1)].sign;
+#if defined(GCC_BUILD) && defined(__linux__)
+	cpu_set_t set;
+	int cpu, count;
+
+	CPU_ZERO(saved);
+	if(sched_getaffinity(0, sizeof(cpu_set_t), saved) != 0)
+	{
+		CPU_ZERO(saved);	/* Nothing To Restore */
+		return;
+	}
+	count = CPU_COUNT(saved);
+	if(count < 2)
+		return;
+
+	/* The (worker % count)th Processor The Process May Use */
+	worker %= (unsigned int) count;
+	for(cpu=0; cpu<CPU_SETSIZE; cpu++)
+		if(CPU_ISSET(cpu, saved) && (worker-- == 0))
+			break;
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	sched_setaffinity(0, sizeof(cpu_set_t), &set);
+#else
+	(void) worker;
+	*saved = 0;
+#endif
 }
 
-/*	The purpose of this function is to swap the specified matrix
-	rows (this is used during the Gauss-Jordan algorithm). Since
-	the only memory locations altered are 2 pointers, this swap
-	method is extremely efficient.
+/*	The purpose of this function is to restore the affinity a thread
+	had before pinThread().
 
 	Parameters: 
-		row1, row2 - rows to swap
-		coeffPtr - pointer to coefficient data structure in which you
-					wish to swap rows
+		saved - affinity saved by pinThread()
 
 	Returns:
-		In case of error (out of bound matrix positioning), the
-		function simply returns without altering any memory.
+		None
 */
-void eqsolver::swapRows(unsigned short int row1, unsigned short int row2, struct fraction **coeffPtr)
+static void unpinThread(THREAD_AFFINITY *saved)
 {
-	struct fraction *temp;	/* Swap Address Holder */
-
-	if((row1 < 1) || (row2 < 1) || (row1 > eqCount) || (row2 > eqCount))
-		return;	/* Out Of Bounds */
-
-	/* Swap Row Pointers */
-	temp = coeffPtr[(row1-1)];
-	coeffPtr[(row1-1)] = coeffPtr[(row2-1)];
-	coeffPtr[(row2-1)] = temp;
+#if defined(GCC_BUILD) && defined(__linux__)
+	if(CPU_COUNT(saved) > 1)
+		sched_setaffinity(0, sizeof(cpu_set_t), saved);
+#else
+	(void) saved;
+#endif
 }
 
-/*	The purpose of this function is reduce the specified fraction
-	to its lowest possible form.
+/*	The purpose of this function is to start up to count threads
+	running routine(parameter).
 
 	Parameters: 
-		unreducedFraction - fraction to reduce
+		handle - receives the handles of the threads started
+		count - # of threads wanted
+		routine - thread function
+		parameter - passed to routine
 
 	Returns:
-		The result of the reduction is returned.
+		# of threads started.
 */
-struct fraction eqsolver::reduce(struct fraction unreducedFraction)
+static unsigned int startThreads(THREAD_HANDLE *handle, unsigned int count, THREAD_FUNCTION routine, void *parameter)
 {
-	struct fraction result;
-	unsigned int gcf, num1, num2, temp;	/* Greatest Common Factor Solving */
+	unsigned int started;
 
-	/* First Check If the unreducedFraction = 0 */
-	/* The 2nd half of this condition is not needed, but added as a 
-		precautionary measure to ENSURE non-divide-by-zero. */
-	if((unreducedFraction.numerator == 0) || (unreducedFraction.denominator == 0))
-	{
-		result.numerator = 0;
-		result.denominator = 0;
-		result.sign = 0;
-		return result;
-	}
-	
-	/* Next Check If The unreducedFraction = 1 */
-	if(unreducedFraction.numerator == unreducedFraction.denominator)
-	{
-		result.numerator = 1;
-		result.denominator = 1;
-		result.sign = unreducedFraction.sign;
-		return result;
-	}
-	
-	num1 = unreducedFraction.numerator;
-	num2 = unreducedFraction.denominator;
-		
-	/* Determine The Greatest Common Factor (Using Euclid's Algorithm) */
-	while (num2)
+	for(started=0; started<count; started++)
 	{
-		temp = num1;	
-		num1 = num2;
-		num2 = temp % num2;
+#ifdef GCC_BUILD
+		if(pthread_create(&handle[started], NULL, routine, parameter) != 0)
+			break;
+#else
+		handle[started] = CreateThread(NULL, 0, routine, parameter, 0, NULL);
+		if(handle[started] == NULL)
+			break;
+#endif
 	}
 
-	gcf = num1;
-
-	result.numerator = unreducedFraction.numerator / gcf;
-	result.denominator = unreducedFraction.denominator / gcf;
-	result.sign = unreducedFraction.sign;
-
-	return result;
+	return started;
 }
 
-/*	The purpose of this function is to divide two "fraction" values
-	and return the result to the caller.
+/*	The purpose of this function is to wait for threads started by
+	startThreads() to finish.
 
 	Parameters: 
-		dividend - fraction which will be divided
-		divisor - fraction by which to divide the dividend
+		handle - thread handles
+		count - # of threads
 
 	Returns:
-		The result of the calculation is returned. Note zero-division
-		is checked but should still be handled by the caller. If a 
-		zero-division occurs, the dividend is returned unaltered.
+		None
 */
-struct fraction eqsolver::divide(struct fraction dividend, struct fraction divisor)
+static void joinThreads(THREAD_HANDLE *handle, unsigned int count)
 {
-	UINT64 overflowCheck;
-	struct fraction result;
-	
-	/* Accomplish Division By Reciprocal Multiplication */
-	
-	/* Calculate Numerator */
-	overflowCheck = (UINT64)dividend.numerator * (UINT64)divisor.denominator;
-	if(overflowCheck > UINT32MAX)
+	unsigned int i;
+
+	for(i=0; i<count; i++)
 	{
-		overFlow = 1;	/* Set Overflow Flag */
-		result.numerator = 0;
-		result.denominator = 0;
-		result.sign = 0;
-		return result;
+#ifdef GCC_BUILD
+		pthread_join(handle[i], NULL);
+#else
+		WaitForSingleObject(handle[i], INFINITE);
+		CloseHandle(handle[i]);
+#endif
 	}
+}
 
-	result.numerator = dividend.numerator * divisor.denominator;
+/* Tasks Shared By The Threads Of runParallel() */
+struct parallelJob
+{
+	void (*task)(void *context, unsigned int index);
+	void *context;
+	unsigned int taskCount;
+	unsigned int nextTask;	/* Next Task Not Yet Taken By A Thread */
+	THREAD_LOCK lock;	/* Guards nextTask */
+};
 
-	/* Calculate Denominator */
-	overflowCheck = (UINT64)dividend.denominator * (UINT64)divisor.numerator;
-	if(overflowCheck > UINT32MAX)
-	{
-		overFlow = 1;	/* Set Overflow Flag */
-		result.numerator = 0;
-		result.denominator = 0;
-		result.sign = 0;
-		return result;
-	}
+/*	The purpose of this function is to run tasks of a parallelJob
+	until none are left. Every thread of runParallel() runs it.
 
-	result.denominator = dividend.denominator * divisor.numerator;
+	Parameters: 
+		parameter - the parallelJob
 
-	/* Prevent Divide By Zero (Should Not Happen If Called Properly) */
-	if((result.numerator != 0) && (result.denominator == 0))
-		return dividend;	/* Return The Dividend Unaltered */
-	
-	/* Set Sign */
-	if(dividend.sign == 1)	/* Dividend Negative? */
-	{
-		if(divisor.sign == 1)	/* Divisor Also Negative? */
-			result.sign = 0;	/* Negative/Negative = Positive */
-		else
-			result.sign = 1;	/* Negative/Positive = Negative */
-	}
-	else	/* Dividend Positive */
+	Returns:
+		Nothing of interest.
+*/
+static THREAD_ROUTINE parallelWorker(void *parameter)
+{
+	struct parallelJob *job = (struct parallelJob *) parameter;
+	unsigned int index;
+
+	for(;;)
 	{
-		if(divisor.sign == 1)	/* Divisor Negative? */
-			result.sign = 1;	/* Positive/Negative = Negative */
-		else
-			result.sign = 0;	/* Positive/Positive = Positive */
+		acquireLock(&job->lock);
+		index = job->nextTask++;
+		releaseLock(&job->lock);
+
+		if(index >= job->taskCount)
+			break;
+		job->task(job->context, index);
 	}
-	
-	/* Reduce Result */
-	result = reduce(result);
 
-	return result;
+	THREAD_RETURN;
 }
 
-/*	The purpose of this function is to multiply two "fraction" values
-	and return the result to the caller.
+/*	The purpose of this function is to return the number of processors
+	available to run threads.
 
 	Parameters: 
-		fraction1 - fraction to by multiplied
-		fraction2 - fraction to be multiplied by
+		None
 
 	Returns:
-		The result of the calculation is returned. Note zero-division
-		is checked but should still be handled by the caller. If a 
-		zero-division occurs, fraction1 is returned unaltered.
+		Processor count (at least 1).
 */
-struct fraction eqsolver::multiply(struct fraction fraction1, struct fraction fraction2)
+static unsigned int processorCount(void)
 {
-	UINT64 overflowCheck;
-	struct fraction result;
-	
-	/* Calculate Numerator */
-	overflowCheck = (UINT64)fraction1.numerator * (UINT64)fraction2.numerator;
-	if(overflowCheck > UINT32MAX)
-	{
-		overFlow = 1;	/* Set Overflow Flag */
-		result.numerator = 0;
-		result.denominator = 0;
-		result.sign = 0;
-		return result;
-	}
+#ifdef GCC_BUILD
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return (count > 1) ? (unsigned int) count : 1;
+#else
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (info.dwNumberOfProcessors > 1) ? (unsigned int) info.dwNumberOfProcessors : 1;
+#endif
+}
 
-	result.numerator = fraction1.numerator * fraction2.numerator;
+/*	The purpose of this function is to run task(context, 0) ..
+	task(context, taskCount-1) on up to threadCount threads, the
+	calling thread included. Tasks must not depend on each other. If a
+	thread can not be created its share is run by the remaining
+	threads.
 
-	/* Calculate Denominator */
-	overflowCheck = (UINT64)fraction1.denominator * (UINT64)fraction2.denominator;
-	if(overflowCheck > UINT32MAX)
+	Parameters: 
+		account - memory account charged by the tasks
+		threadCount - maximum # of threads, 0 = one per processor
+		taskCount - # of tasks
+		task - function run for each task
+		context - passed to task
+
+	Returns:
+		None (once every task has finished)
+*/
+static void runParallel(struct memoryAccount *account, unsigned int threadCount, unsigned int taskCount,
+						void (*task)(void *context, unsigned int index), void *context)
+{
+	struct parallelJob job;
+	THREAD_HANDLE *handle;
+	THREAD_LOCK accountLock;
+	unsigned int i, started;
+	int shared;
+
+	if(threadCount == 0)
+		threadCount = processorCount();
+	if(threadCount > taskCount)
+		threadCount = taskCount;
+
+	job.task = task;
+	job.context = context;
+	job.taskCount = taskCount;
+	job.nextTask = 0;
+
+	handle = NULL;
+	if(threadCount > 1)
+		handle = (THREAD_HANDLE *) allocateFrom(account, (threadCount-1) * sizeof(THREAD_HANDLE));
+
+	/* Single Thread, Or No Room To Track Threads */
+	if(handle == NULL)
 	{
-		overFlow = 1;	/* Set Overflow Flag */
-		result.numerator = 0;
-		result.denominator = 0;
-		result.sign = 0;
-		return result;
+		for(i=0; i<taskCount; i++)
+			task(context, i);
+		return;
 	}
 
-	result.denominator = fraction1.denominator * fraction2.denominator;
+	createLock(&job.lock);
+	shared = shareAccount(account, &accountLock);
 
-	/* Prevent Divide By Zero (Should Not Happen If Called Properly) */
-	if((result.numerator != 0) && (result.denominator == 0))
-		return fraction1;	/* Return fraction1  Unaltered */
+	started = startThreads(handle, (threadCount-1), parallelWorker, &job);
+	parallelWorker(&job);	/* Calling Thread Works Too */
+	joinThreads(handle, started);
 
-	/* Set Sign */
-	if(fraction1.sign == 1)	/* fraction1 Negative? */
-	{
-		if(fraction2.sign == 1)	/* fraction2 Also Negative? */
-			result.sign = 0;	/* Negative*Negative = Positive */
-		else
-			result.sign = 1;	/* Negative*Positive = Negative */
-	}
-	else	/* Dividend Positive */
+	if(shared)
+		unshareAccount(account);
+	destroyLock(&job.lock);
+
+	releaseTo(account, handle);
+}
+
+/* Tasks Owned By Fixed Threads, Run By runOwned() */
+struct ownedJob
+{
+	void (*task)(void *context, unsigned int index);
+	void *context;
+	unsigned int taskCount;
+	unsigned int workerCount;
+	unsigned int nextWorker;	/* Worker # Of The Next Thread To Start */
+	THREAD_LOCK lock;	/* Guards nextWorker */
+};
+
+/*	The purpose of this function is to run the tasks a worker owns:
+	task # worker, worker + workerCount, ... Every thread of
+	runOwned() runs it, pinned like the workers of runGraph().
+
+	Parameters: 
+		parameter - the ownedJob
+
+	Returns:
+		Nothing of interest.
+*/
+static THREAD_ROUTINE ownedWorker(void *parameter)
+{
+	struct ownedJob *job = (struct ownedJob *) parameter;
+	THREAD_AFFINITY saved;
+	unsigned int worker, index;
+
+	acquireLock(&job->lock);
+	worker = job->nextWorker++;
+	releaseLock(&job->lock);
+
+	pinThread(worker, &saved);
+	for(index=worker; index<job->taskCount; index+=job->workerCount)
+		job->task(job->context, index);
+	unpinThread(&saved);
+
+	THREAD_RETURN;
+}
+
+/*	The purpose of this function is to run task(context, 0) ..
+	task(context, taskCount-1) on up to threadCount threads such that
+	task i always runs on worker i % threadCount, the worker runGraph()
+	pins to the same processor and hands the tasks owned by i. Used to
+	place memory: what a worker's tasks write first lands on its NUMA
+	node. Tasks of workers whose thread can not be created are run by
+	the calling thread.
+
+	Parameters: 
+		account - memory account charged by the tasks
+		threadCount - maximum # of threads, 0 = one per processor
+		taskCount - # of tasks
+		task - function run for each task
+		context - passed to task
+
+	Returns:
+		None (once every task has finished)
+*/
+static void runOwned(struct memoryAccount *account, unsigned int threadCount, unsigned int taskCount,
+					 void (*task)(void *context, unsigned int index), void *context)
+{
+	struct ownedJob job;
+	THREAD_HANDLE *handle;
+	THREAD_LOCK accountLock;
+	unsigned int i, started;
+	int shared;
+
+	if(threadCount == 0)
+		threadCount = processorCount();
+	if(threadCount > taskCount)
+		threadCount = taskCount;
+
+	handle = NULL;
+	if(threadCount > 1)
+		handle = (THREAD_HANDLE *) allocateFrom(account, (threadCount-1) * sizeof(THREAD_HANDLE));
+
+	/* Single Thread, Or No Room To Track Threads */
+	if(handle == NULL)
 	{
-		if(fraction2.sign == 1)	/* fraction2 Negative? */
-			result.sign = 1;	/* Positive*Negative = Negative */
-		else
-			result.sign = 0;	/* Positive*Positive = Positive */
+		for(i=0; i<taskCount; i++)
+			task(context, i);
+		return;
 	}
 
-	/* Reduce Result */
-	result = reduce(result);
+	job.task = task;
+	job.context = context;
+	job.taskCount = taskCount;
+	job.workerCount = threadCount;
+	job.nextWorker = 0;
+	createLock(&job.lock);
+	shared = shareAccount(account, &accountLock);
 
-	return result;
+	started = startThreads(handle, (threadCount-1), ownedWorker, &job);
+	ownedWorker(&job);	/* Calling Thread Works Too */
+	joinThreads(handle, started);
+	if(shared)
+		unshareAccount(account);
+
+	/* Workers Never Started */
+	for(; job.nextWorker<threadCount; job.nextWorker++)
+		for(i=job.nextWorker; i<taskCount; i+=threadCount)
+			task(context, i);
+
+	destroyLock(&job.lock);
+
+	releaseTo(account, handle);
 }
 
-/*	The purpose of this function is to add two "fraction" values
-	and return the result to the caller.
+/* Tasks With Dependencies, Run By runGraph() */
+struct taskGraph
+{
+	int (*task)(void *context, unsigned int index);	/* Runs A Task, Nonzero = Skip Its Successors */
+	unsigned int (*successors)(void *context, unsigned int index, unsigned int *list);	/* Lists The Tasks Waiting On A Task, Returns # */
+	unsigned int (*owner)(void *context, unsigned int index);	/* Worker (Modulo # Of Threads) A Task Belongs To, NULL = Any */
+	void *context;
+	unsigned int taskCount;
+	unsigned int maxSuccessors;	/* Most Successors Of Any Task */
+	unsigned int *waiting;	/* # Of Unfinished Predecessors Of Each Task (Counted Down) */
+};
+
+/* State Shared By The Threads Of runGraph(): A Deque Of Ready Tasks
+	Per Thread, Linked Through next / previous (taskCount = None) */
+struct graphJob
+{
+	struct taskGraph *graph;
+	unsigned int dequeCount;
+	unsigned int *head, *tail;	/* Oldest & Newest Task Of Each Deque */
+	unsigned int *next, *previous;	/* Toward The Newest & Oldest Task */
+	unsigned char *skip;	/* Task Skipped Because A Predecessor Asked So */
+	unsigned int *list;	/* maxSuccessors Entries Per Thread */
+	unsigned int finished;	/* # Of Tasks Run Or Skipped */
+	unsigned int nextWorker;	/* Deque Of The Next Thread To Start */
+	THREAD_LOCK *dequeLock;	/* Guards Each Deque */
+	THREAD_LOCK lock;	/* Guards waiting, skip, finished & nextWorker */
+};
+
+/*	The purpose of this function is to add a ready task at the newest
+	end of a deque.
 
 	Parameters: 
-		fraction1, fraction 2 - fractions to be added
+		job - the graphJob
+		deque - deque #
+		index - task #
 
 	Returns:
-		The result of the calculation is returned. Note zero-division
-		is checked but should still be handled by the caller. If a 
-		zero-division occurs, fraction1 is returned unaltered.
+		None
 */
-struct fraction eqsolver::add(struct fraction fraction1, struct fraction fraction2)
+static void pushTask(struct graphJob *job, unsigned int deque, unsigned int index)
 {
-	UINT64 overflowCheck;
-	INT64 overflowCheckWithSign, num1OverflowCheckWithSign, num2OverflowCheckWithSign;
-	int num1, num2, resultNum;
-	struct fraction result;
-	
-	/* Verify Niether Fraction Is 0 */
-	if((fraction1.numerator == 0) && (fraction1.denominator == 0))
-		return fraction2;
+	unsigned int none = job->graph->taskCount;
 
-	if((fraction2.numerator == 0) && (fraction2.denominator == 0))
-		return fraction1;
+	acquireLock(&job->dequeLock[deque]);
+	job->next[index] = none;
+	job->previous[index] = job->tail[deque];
+	if(job->tail[deque] == none)
+		job->head[deque] = index;
+	else
+		job->next[job->tail[deque]] = index;
+	job->tail[deque] = index;
+	releaseLock(&job->dequeLock[deque]);
+}
 
-	/* Do Calculations Here */
-	/* Set Numerator */
+/*	The purpose of this function is to take a task off a deque: the
+	newest one from a thread's own deque (the task it just enabled,
+	likely still in cache), the oldest one when stealing from another
+	thread's deque.
 
-	/* Are Both Numerators Positive? */
-	if((fraction1.sign == 0) && (fraction2.sign == 0))
+	Parameters: 
+		job - the graphJob
+		deque - deque #
+		newest - 1 = newest end, 0 = oldest end
+
+	Returns:
+		Task #, or taskCount if the deque is empty.
+*/
+static unsigned int takeTask(struct graphJob *job, unsigned int deque, int newest)
+{
+	unsigned int none = job->graph->taskCount;
+	unsigned int index;
+
+	acquireLock(&job->dequeLock[deque]);
+	index = newest ? job->tail[deque] : job->head[deque];
+	if(index != none)
 	{
-		/* Stay In True Unsigned 32-bit Representation */
-		overflowCheck = ((UINT64)fraction1.numerator * (UINT64)fraction2.denominator) + ((UINT64)fraction2.numerator * (UINT64)fraction1.denominator);
-		if(overflowCheck > UINT32MAX)
+		if(newest)
 		{
-			overFlow = 1;	/* Set Overflow Flag */
-			result.numerator = 0;
-			result.denominator = 0;
-			result.sign = 0;
-			return result;
+			job->tail[deque] = job->previous[index];
+			if(job->tail[deque] == none)
+				job->head[deque] = none;
+			else
+				job->next[job->tail[deque]] = none;
+		}
+		else
+		{
+			job->head[deque] = job->next[index];
+			if(job->head[deque] == none)
+				job->tail[deque] = none;
+			else
+				job->previous[job->head[deque]] = none;
 		}
-		result.numerator = (fraction1.numerator * fraction2.denominator) + (fraction2.numerator * fraction1.denominator);
 	}
-	else	/* One Of The Numbers Is Negative */
+	releaseLock(&job->dequeLock[deque]);
+
+	return index;
+}
+
+/*	The purpose of this function is to run ready tasks of a graphJob
+	until every task has finished, stealing from the other threads'
+	deques when its own is empty. A finished task makes the successors
+	it was the last predecessor of ready, on the deque of the worker
+	owning them (see taskGraph), else on this thread's deque. Every
+	thread of runGraph() runs it, pinned to the processor of its
+	worker # unless it is the only one.
+
+	Parameters: 
+		parameter - the graphJob
+
+	Returns:
+		Nothing of interest.
+*/
+static THREAD_ROUTINE graphWorker(void *parameter)
+{
+	struct graphJob *job = (struct graphJob *) parameter;
+	struct taskGraph *graph = job->graph;
+	THREAD_AFFINITY saved;
+	unsigned int self, index, victim, count, i, done;
+	unsigned int *list;
+	int result;
+
+	acquireLock(&job->lock);
+	self = job->nextWorker++;
+	releaseLock(&job->lock);
+	list = &job->list[(self * graph->maxSuccessors)];
+	if(job->dequeCount > 1)	/* A Lone Worker Is Left Where It Runs, Maybe Inside runParallel() */
+		pinThread(self, &saved);
+
+	for(;;)
 	{
-		/* First Check For Overflow In Necessary Calculations */
-		if(fraction1.sign == 1)
+		index = takeTask(job, self, 1);
+		for(i=1; (i<job->dequeCount) && (index == graph->taskCount); i++)
 		{
-			num1OverflowCheckWithSign = (INT64)fraction1.numerator * -1;
-			if(num1OverflowCheckWithSign < INT32MIN)
-			{
-				
-				overFlow = 1;	/* Set Overflow Flag */
-				result.numerator = 0;
-				result.denominator = 0;
-				result.sign = 0;
-				return result;
-			}
+			victim = (self+i) % job->dequeCount;
+			index = takeTask(job, victim, 0);
 		}
-		else
+
+		if(index == graph->taskCount)
 		{
-			num1OverflowCheckWithSign = (INT64)fraction1.numerator;
-			if(num1OverflowCheckWithSign > INT32MAX)
-			{
-				
-				overFlow = 1;	/* Set Overflow Flag */
-				result.numerator = 0;
-				result.denominator = 0;
-				result.sign = 0;
-				return result;
-			}
+			acquireLock(&job->lock);
+			done = (job->finished == graph->taskCount);
+			releaseLock(&job->lock);
+			if(done)
+				break;
+			yieldThread();	/* Tasks Still Running, More May Become Ready */
+			continue;
 		}
-		if(fraction2.sign == 1)
+
+		result = 0;
+		if(!job->skip[index])
+			result = graph->task(graph->context, index);
+		count = graph->successors(graph->context, index, list);
+
+		acquireLock(&job->lock);
+		for(i=0; i<count; i++)
 		{
-			num2OverflowCheckWithSign = (INT64)fraction2.numerator * -1;
-			if(num2OverflowCheckWithSign < INT32MIN)
-			{
-				overFlow = 1;	/* Set Overflow Flag */
-				result.numerator = 0;
-				result.denominator = 0;
-				result.sign = 0;
-				return result;
-			}
+			if(result || job->skip[index])
+				job->skip[list[i]] = 1;
+			if(--graph->waiting[list[i]] == 0)
+				pushTask(job, ((graph->owner != NULL) ? (graph->owner(graph->context, list[i]) % job->dequeCount) : self), list[i]);
 		}
-		else
+		job->finished++;
+		releaseLock(&job->lock);
+	}
+
+	if(job->dequeCount > 1)
+		unpinThread(&saved);
+
+	THREAD_RETURN;
+}
+
+/*	The purpose of this function is to run the tasks of a graph, each
+	once all of its predecessors have finished, on up to threadCount
+	threads (the calling thread included) by work stealing: there are
+	no barriers, a thread only waits when no task at all is ready. If a
+	thread can not be created its deque is emptied by the others.
+
+	Parameters: 
+		account - memory account charged by the scheduler & tasks
+		threadCount - maximum # of threads, 0 = one per processor
+		graph - tasks & dependencies (waiting is counted down to 0)
+
+	Returns:
+		1 once every task has finished, 0 on allocation errors (no
+		task run).
+*/
+static int runGraph(struct memoryAccount *account, unsigned int threadCount, struct taskGraph *graph)
+{
+	struct graphJob job;
+	THREAD_HANDLE *handle;
+	THREAD_LOCK accountLock;
+	unsigned int i, deque, started;
+	int success, shared;
+
+	if(threadCount == 0)
+		threadCount = processorCount();
+	if(threadCount > graph->taskCount)
+		threadCount = graph->taskCount;
+	if(threadCount == 0)
+		return 1;	/* No Tasks */
+
+	job.graph = graph;
+	job.dequeCount = threadCount;
+	job.finished = 0;
+	job.nextWorker = 0;
+	job.head = (unsigned int *) allocateFrom(account, threadCount * sizeof(unsigned int));
+	job.tail = (unsigned int *) allocateFrom(account, threadCount * sizeof(unsigned int));
+	job.next = (unsigned int *) allocateFrom(account, graph->taskCount * sizeof(unsigned int));
+	job.previous = (unsigned int *) allocateFrom(account, graph->taskCount * sizeof(unsigned int));
+	job.skip = (unsigned char *) allocateFrom(account, graph->taskCount * sizeof(unsigned char));
+	job.list = (unsigned int *) allocateFrom(account, (threadCount * graph->maxSuccessors + 1) * sizeof(unsigned int));
+	job.dequeLock = (THREAD_LOCK *) allocateFrom(account, threadCount * sizeof(THREAD_LOCK));
+	handle = NULL;
+	if(threadCount > 1)
+		handle = (THREAD_HANDLE *) allocateFrom(account, (threadCount-1) * sizeof(THREAD_HANDLE));
+
+	success = (job.head != NULL) && (job.tail != NULL) && (job.next != NULL) && (job.previous != NULL) &&
+		(job.skip != NULL) && (job.list != NULL) && (job.dequeLock != NULL) && ((threadCount == 1) || (handle != NULL));
+
+	if(success)
+	{
+		createLock(&job.lock);
+		for(deque=0; deque<threadCount; deque++)
 		{
-			num2OverflowCheckWithSign = (INT64)fraction2.numerator;
-			if(num1OverflowCheckWithSign > INT32MAX)
+			createLock(&job.dequeLock[deque]);
+			job.head[deque] = job.tail[deque] = graph->taskCount;
+		}
+
+		/* Tasks Ready From The Start, Dealt Out To The Deques */
+		deque = 0;
+		for(i=0; i<graph->taskCount; i++)
+		{
+			job.skip[i] = 0;
+			if(graph->waiting[i] == 0)
 			{
-				overFlow = 1;	/* Set Overflow Flag */
-				result.numerator = 0;
-				result.denominator = 0;
-				result.sign = 0;
-				return result;
+				if(graph->owner != NULL)
+					deque = graph->owner(graph->context, i) % threadCount;
+				pushTask(&job, deque, i);
+				deque = (deque+1) % threadCount;
 			}
 		}
-		
+
+		started = 0;
+		shared = 0;
+		if(threadCount > 1)
+		{
+			shared = shareAccount(account, &accountLock);
+			started = startThreads(handle, (threadCount-1), graphWorker, &job);
+		}
+		graphWorker(&job);	/* Calling Thread Works Too */
+		joinThreads(handle, started);
+		if(shared)
+			unshareAccount(account);
+
+		for(deque=0; deque<threadCount; deque++)
+			destroyLock(&job.dequeLock[deque]);
+		destroyLock(&job.lock);
+	}
+
+	releaseTo(account, job.head);
+	releaseTo(account, job.tail);
+	releaseTo(account, job.next);
+	releaseTo(account, job.previous);
+	releaseTo(account, job.skip);
+	releaseTo(account, job.list);
+	releaseTo(account, job.dequeLock);
+	releaseTo(account, handle);
+
+	return success;
+}
+
+/* Huge Page Arena, One Mapping Holding All Matrices Of A System */
+#define HUGE_PAGE_SIZE 2097152	/* 2MB, x86-64 & ARM64 Default */
+
+/*	The purpose of this function is to map an arena backed by huge
+	pages, so walking a pivot column down thousands of rows touches a
+	few TLB entries instead of one per row. Explicit huge pages are
+	tried first (Linux MAP_HUGETLB, Win32 MEM_LARGE_PAGES, which needs
+	the "Lock pages in memory" privilege); if none are reserved the
+	arena is mapped with ordinary pages, aligned to HUGE_PAGE_SIZE and
+	offered to transparent huge pages on Linux. The memory is zeroed.
+
+	Parameters: 
+		size - bytes needed, rounded up to HUGE_PAGE_SIZE in place
+
+	Returns:
+		The arena, NULL if it could not be mapped.
+*/
+static void *mapArena(UINT64 &size)
+{
+	void *base;
+
+	size = ((size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+	if(size != (UINT64)(size_t) size)
+		return NULL;	/* Too Large For The Address Space */
+
+#ifdef GCC_BUILD
+	char *raw;
+	size_t head, tail;
+
+#ifdef MAP_HUGETLB
+	base = mmap(NULL, (size_t) size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if(base != MAP_FAILED)
+		return base;
+#endif
+
+	/* Over-Map By One Huge Page, Trim To An Aligned Range */
+	raw = (char *) mmap(NULL, (size_t) size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(raw == (char *) MAP_FAILED)
+		return NULL;
+
+	head = (HUGE_PAGE_SIZE - ((size_t) raw % HUGE_PAGE_SIZE)) % HUGE_PAGE_SIZE;
+	tail = HUGE_PAGE_SIZE - head;
+	if(head != 0)
+		munmap(raw, head);
+	if(tail != 0)
+		munmap(raw + head + (size_t) size, tail);
+	base = raw + head;
+
+#ifdef MADV_HUGEPAGE
+	madvise(base, (size_t) size, MADV_HUGEPAGE);
+#endif
+#else
+	base = NULL;
+#ifdef MEM_LARGE_PAGES
+	if((GetLargePageMinimum() != 0) && ((size % GetLargePageMinimum()) == 0))
+		base = VirtualAlloc(NULL, (SIZE_T) size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+#endif
+	if(base == NULL)
+		base = VirtualAlloc(NULL, (SIZE_T) size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#endif
+
+	return base;
+}
+
+/*	The purpose of this function is to map an arena onto a file, for
+	systems larger than memory: the operating system pages parts of
+	the matrices in and out as elimination reaches them. The file is
+	created (or truncated), sized sparse & thus zeroed, and deleted
+	right away (Win32: once unmapped), so nothing is left behind even
+	if the process dies.
+
+	Parameters: 
+		path - file to create, on local disk
+		size - bytes needed
+
+	Returns:
+		The arena, NULL if the file could not be created or mapped.
+*/
+static void *mapArenaFile(const char *path, UINT64 size)
+{
+	void *base;
+
+	if(size != (UINT64)(size_t) size)
+		return NULL;	/* Too Large For The Address Space */
+
+#ifdef GCC_BUILD
+	int file;
+
+	file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+	if(file < 0)
+		return NULL;
+
+	base = MAP_FAILED;
+	if(ftruncate(file, (off_t) size) == 0)
+		base = mmap(NULL, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	close(file);
+	unlink(path);
+
+	if(base == MAP_FAILED)
+		return NULL;
+#else
+	HANDLE file, mapping;
+
+	file = CreateFile(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS,
+		FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, NULL);
+	if(file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	mapping = CreateFileMapping(file, NULL, PAGE_READWRITE, (DWORD)(size >> 32), (DWORD) size, NULL);
+	CloseHandle(file);	/* The Mapping Keeps It Open */
+	if(mapping == NULL)
+		return NULL;
+
+	base = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T) size);
+	CloseHandle(mapping);	/* The View Keeps It Open */
+#endif
+
+	return base;
+}
+
+/*	The purpose of this function is to release an arena mapped by
+	mapArena() or mapArenaFile(), all of it at once.
+
+	Parameters: 
+		base - the arena
+		size - its size as returned by mapArena()
+		fileBacked - 1 if mapped by mapArenaFile()
+
+	Returns:
+		None
+*/
+static void unmapArena(void *base, UINT64 size, int fileBacked)
+{
+#ifdef GCC_BUILD
+	(void) fileBacked;
+	munmap(base, (size_t) size);
+#else
+	(void) size;
+	if(fileBacked)
+		UnmapViewOfFile(base);
+	else
+		VirtualFree(base, 0, MEM_RELEASE);
+#endif
+}
+
+/* Widens One Entry Of Compact Storage (See compactNumerator) To The
+	Fraction setCoefficient() / setCoefficientFraction() Would Store */
+static struct fraction widenCompact(const short int *numerator, const short int *denominator, UINT64 index)
+{
+	struct fraction value;
+	int top, bottom;
+
+	top = numerator[index];
+	bottom = (denominator != NULL) ? denominator[index] : ((top == 0) ? 0 : 1);
+
+	value.numerator = (bottom == 0) ? 0 : (unsigned int) abs(top);	/* x/0 Is Stored As 0/0 */
+	value.denominator = (unsigned int) abs(bottom);
+	value.sign = ((top < 0) != (bottom < 0)) ? 1 : 0;
+
+	return value;
+}
+
+/* 1 = A Numerator / Denominator Pair Reads The Same In Compact Storage
+	Without Denominators: An Integer, Or 0/0 */
+static int integerPair(short int numerator, short int denominator)
+{
+	return ((numerator != 0) && (denominator == 1)) || ((numerator == 0) && (denominator == 0));
+}
+
+/* Converts An Integer Of Up To 32 Bits (Magnitude) To A Fraction, 0 To 0/0 */
+static struct fraction integerFraction(INT64 value)
+{
+	struct fraction result;
+
+	result.numerator = (unsigned int) ((value < 0) ? -value : value);
+	result.denominator = (value == 0) ? 0 : 1;
+	result.sign = (value < 0) ? 1 : 0;
+
+	return result;
+}
+
+/* 1 = A Reduced Fraction Fits A 16-bit Numerator / Denominator Pair */
+static int narrowFraction(struct fraction value)
+{
+	return (value.denominator <= 32767) && (value.numerator <= ((value.sign == 1) ? 32768U : 32767U));
+}
+
+/* Signed 16-bit Numerator Of A Fraction narrowFraction() Accepted */
+static short int narrowNumerator(struct fraction value)
+{
+	return (short int) ((value.sign == 1) ? -((int) value.numerator) : (int) value.numerator);
+}
+
+/*	The purpose of this function is to allocate and zero-initialize
+	the memory required to store the N+1xN matrix coefficients. It 
+	allocates space for an "original" matrix which will be unaltered.
+	The original matrix is located by the member variable
+	originalCoefficient, or while it is held in its 16-bit input form
+	(the default, see setCompactStorage()) by compactNumerator. The
+	altered matrix, located by the member variable coefficient, is
+	only allocated (as a copy of the original) once the row operations
+	change it, see prepareAltered().
+
+	Parameters: 
+		count - Unsigned 16-bit value between 0-65536 which represents
+				the number of simultaneous equations to solve.
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+unsigned int eqsolver::setSystemEqCount(unsigned short int count)
+{
+	unsigned int i;	/* Loop Counter */
+	int compact;	/* 1 = "original" Matrix In Compact Storage */
+	
+	/* No Need To Allocate Space, Empty System */
+	if(count == 0)
+		return 1;
+	
+	eqCount = count;	/* Store # Of Simulatenous Equations In System */
+	streamRank = 0;	/* No Equations Absorbed Yet */
+	streamStatus = 0;
+
+	/* The "original" Matrix Is Only Read To Start & Verify A Solve, So
+		It Is Kept As Given (2 Or 4 Bytes Per Value Instead Of 12),
+		Except In The Tile File, Which Costs No Memory */
+	compact = compactEnabled && (outOfCorePath == NULL);
+	
+	/* Tile File Or Huge Page Arena For All Matrices, Else Each Row Is
+		malloc()ed. Without Its Tile File An Out-Of-Core System Would
+		Not Fit */
+	if((outOfCorePath != NULL) && (arena == NULL) && !createArena(count, 1))
+		return 0;
+	if(hugePagesEnabled && (arena == NULL))
+		createArena(count, !compact);
+
+	/* Allocate Array Of Matrix Row Pointers, Or Compact Storage */
+	if(compact)
+		compactNumerator = (short int *) allocateMemory((size_t) count * (count+1) * sizeof(short int));
+	else
+		originalCoefficient = (struct fraction **) allocateMemory(count * sizeof(struct fraction *));
+
+	/* Allocate Array Of Fractions For Solution Storage*/
+	if(arena != NULL)
+		solutionCoefficient = arenaRegion(ARENA_SOLUTION);
+	else
+		solutionCoefficient = (struct fraction *) allocateMemory(count * sizeof(struct fraction));
+	pivotColumn = (unsigned short int *) allocateMemory(count * sizeof(unsigned short int));
+
+	/* Check For Memory Allocation Error */
+	if(((originalCoefficient == NULL) && (compactNumerator == NULL)) || (solutionCoefficient == NULL) || (pivotColumn == NULL))
+	{
+		eqCount = 0;	/* No Rows Yet, cleanup() Frees The Rest */
+		return 0;
+	}
+	
+	/* Zero Initialize Solution Array */
+	for(i=0; i<count; i++)
+	{
+		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
+		solutionCoefficient[i].sign = 0;
+
+	}
+	/* Allocate & Zero Initialize Row Coefficients, Row Blocks On The
+		NUMA Node Of The Thread Eliminating Them */
+	if(compact)
+		memset(compactNumerator, 0, (size_t) count * (count+1) * sizeof(short int));
+	if(!compact && !placeRows(originalCoefficient, NULL, arenaRegion(ARENA_ORIGINAL)))
+		return 0;	/* Review Explanation Above */
+
+	return 1;	/* Signals No Error */
+}
+
+/*	The purpose of this function is to set the specified matrix
+	coefficient (in row,column order) to the specified value. This
+	value may be any number between -32768 to 32767 inclusive.
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1)
+		value - value at which to set the specified coefficient
+
+	Returns:
+		In case of error (out of bound matrix positioning), the
+		function simply returns without altering any memory.
+*/
+void eqsolver::setCoefficient(unsigned short int row, unsigned short int column, short int value)
+{
+	struct fraction entry;
+
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+		return;	/* Out Of Bounds, Simply Return */
+
+	releaseFactorization();	/* Inverse No Longer Matches */
+
+	/* Band Or Symmetric Storage, Unless The Value Falls Outside The Band */
+	if((originalCoefficient == NULL) && (compactNumerator == NULL))
+	{
+		if(storeValue((row-1), (column-1), makeFraction(value, 1)) || !expandStorage())
+			return;
+	}
+
+	/* Compact Storage Keeps The Value As Given */
+	if((compactNumerator != NULL) && !storeCompact((row-1), (column-1), value, (value == 0) ? 0 : 1))
+		return;
+
+	/* Set Specified Coefficient Numerator To Specified Value */
+	if(value < 0)
+	{
+		entry.numerator = (unsigned int) abs((int)value);
+		entry.sign = 1;
+	}
+	else
+	{
+		entry.numerator = (unsigned int) value;	/* Cast To 32-bits */
+		entry.sign = 0;
+	}
+
+	/* Set Denominator */
+	if(value == 0)	/* Value Will Be 0/0, not 0/1 */
+		entry.denominator = 0;
+	else
+		entry.denominator = 1;
+
+	/* The Altered Matrix Only Exists Once Row Operations Changed It */
+	if(originalCoefficient != NULL)
+		originalCoefficient[(row-1)][(column-1)] = entry;
+	if(coefficient != NULL)
+		coefficient[(row-1)][(column-1)] = entry;
+}
+
+/*	The purpose of this function is to set the specified matrix
+	coefficient (in row,column order) to the specified value. This
+	value may be any number between -32768 to 32767 inclusive. In 
+	this setCoefficient() variation, both the numerator & denominator
+	can be set.
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1)
+		numerator - value at which to set the specified coefficient numerator
+		denominator - value at which to set the specified coefficient denominator
+
+	Returns:
+		In case of error (out of bound matrix positioning), the
+		function simply returns without altering any memory.
+*/
+void eqsolver::setCoefficientFraction(unsigned short int row, unsigned short int column, short int numerator, short int denominator)	/* Sets Coefficient Value In Fraction Form */
+{
+	struct fraction entry;
+
+		/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+		return;	/* Out Of Bounds, Simply Return */
+
+	releaseFactorization();	/* Inverse No Longer Matches */
+
+	/* Band Or Symmetric Storage, Unless The Value Falls Outside The Band */
+	if((originalCoefficient == NULL) && (compactNumerator == NULL))
+	{
+		if(storeValue((row-1), (column-1), makeFraction(numerator, denominator)) || !expandStorage())
+			return;
+	}
+
+	/* Compact Storage Keeps The Value As Given */
+	if((compactNumerator != NULL) && !storeCompact((row-1), (column-1), numerator, denominator))
+		return;
+
+	/* Set Specified Coefficient Numerator To Specified Value */
+	entry.numerator = (unsigned int) abs((int)numerator);
+	
+	/* Set Denominator */
+	if(denominator == 0)	/* Value Will Be 0/0 (Prevents Division By Zero */
+	{
+		entry.numerator = 0;
+		entry.denominator = 0;
+	}
+	else
+		entry.denominator = (unsigned int) abs((int)denominator);
+
+	/* Set Sign */
+	if(numerator < 0)
+	{
+		if(denominator < 0)
+			entry.sign = 0;
+		else
+			entry.sign = 1;
+	}
+	else
+	{
+		if(denominator < 0)
+			entry.sign = 1;
+		else
+			entry.sign = 0;
+	}
+
+	/* The Altered Matrix Only Exists Once Row Operations Changed It */
+	if(originalCoefficient != NULL)
+		originalCoefficient[(row-1)][(column-1)] = entry;
+	if(coefficient != NULL)
+		coefficient[(row-1)][(column-1)] = entry;
+}
+
+/*	The purpose of this function is to set the specified matrix
+	coefficient to a 32 or 64-bit integer, see setCoefficientFraction64().
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1)
+		value - value at which to set the specified coefficient
+
+	Returns:
+		1 on success
+		0 in case of an error (out of bound matrix positioning, a value
+		outside -4294967295 .. 4294967295, memory allocation errors),
+		nothing is changed then
+*/
+unsigned int eqsolver::setCoefficient64(unsigned short int row, unsigned short int column, INT64 value)
+{
+	return setCoefficientFraction64(row, column, value, 1);
+}
+
+/*	The purpose of this function is to set the specified matrix
+	coefficient to a fraction of 32 or 64-bit integers. The fraction
+	is reduced first, then stored in the narrowest form holding it: a
+	value whose reduced numerator & denominator fit 16 bits is set as
+	setCoefficientFraction() would (compact, band & symmetric storage
+	are kept), any other value is held as a 32-bit fraction. A value
+	which still exceeds 32 bits once reduced can't be held exactly
+	and is refused rather than rounded.
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1)
+		numerator - value at which to set the specified coefficient numerator
+		denominator - value at which to set the specified coefficient denominator
+
+	Returns:
+		1 on success
+		0 in case of an error (out of bound matrix positioning, a
+		reduced numerator or denominator above 4294967295, memory
+		allocation errors), nothing is changed then
+*/
+unsigned int eqsolver::setCoefficientFraction64(unsigned short int row, unsigned short int column, INT64 numerator, INT64 denominator)
+{
+	struct fraction entry;
+
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+		return 0;
+
+	if(!reduceRational(numerator, denominator, entry))
+		return 0;	/* Too Large For A Fraction */
+
+	/* Fits The 16-bit Setters */
+	if(narrowFraction(entry))
+	{
+		setCoefficientFraction(row, column, narrowNumerator(entry), (short int) entry.denominator);
+		return 1;
+	}
+
+	releaseFactorization();	/* Inverse No Longer Matches */
+
+	/* Band Or Symmetric Storage, Unless The Value Falls Outside The Band */
+	if((originalCoefficient == NULL) && (compactNumerator == NULL))
+	{
+		if(storeValue((row-1), (column-1), entry))
+			return 1;
+		if(!expandStorage())
+			return 0;
+	}
+
+	/* Compact Storage Can't Hold The Value */
+	if(!widenOriginal())
+		return 0;
+
+	originalCoefficient[(row-1)][(column-1)] = entry;
+	if(coefficient != NULL)
+		coefficient[(row-1)][(column-1)] = entry;
+
+	return 1;
+}
+
+/*	The purpose of this function is to reduce a fraction of 64-bit
+	integers to lowest terms, as the 32-bit fraction storing it. A 0
+	numerator or denominator yields 0 (0/0), as in
+	setCoefficientFraction().
+
+	Parameters: 
+		numerator, denominator - value to reduce
+		value - reference to fraction structure (stores result)
+
+	Returns:
+		1 on success, 0 if the reduced numerator or denominator exceeds
+		32 bits (value is 0/0 then).
+*/
+int eqsolver::reduceRational(INT64 numerator, INT64 denominator, struct fraction &value)
+{
+	UINT64 top, bottom, common;
+
+	value.numerator = value.denominator = 0;
+	value.sign = 0;
+
+	/* Magnitudes, Without Negating -2^63 */
+	top = (numerator < 0) ? ((UINT64) -(numerator+1)) + 1 : (UINT64) numerator;
+	bottom = (denominator < 0) ? ((UINT64) -(denominator+1)) + 1 : (UINT64) denominator;
+	if((top == 0) || (bottom == 0))
+		return 1;
+
+	common = gcd64(top, bottom);
+	top = top / common;
+	bottom = bottom / common;
+	if((top > (UINT64) UINT32MAX) || (bottom > (UINT64) UINT32MAX))
+		return 0;
+
+	value.numerator = (unsigned int) top;
+	value.denominator = (unsigned int) bottom;
+	value.sign = ((numerator < 0) != (denominator < 0)) ? 1 : 0;
+
+	return 1;
+}
+
+/*	The purpose of this function is to set every coefficient of the
+	system at once from a contiguous array, row after row (eqCount+1
+	values per row, the RHS last), as eqCount x (eqCount+1) calls of
+	setCoefficient() would. The array is copied into storage as is;
+	bounds are checked once. Since every value is replaced, the
+	altered matrix reads as the new system again (row operations done
+	so far are dropped), as do equations absorbed by addEquation().
+	Band, symmetric & structured storage take the values one by one
+	instead, and are kept as long as the values fit them.
+
+	Parameters: 
+		values - eqCount x (eqCount+1) coefficients, row-major
+
+	Returns:
+		1 on success
+		0 in case of an error (system not dimensioned, memory
+		allocation errors)
+*/
+unsigned int eqsolver::setCoefficients(const short int *values)
+{
+	UINT64 count;
+	unsigned int i, j;
+
+	if((bandCoefficient != NULL) || (symmetricCoefficient != NULL) || (structureType != STRUCTURE_NONE))
+	{
+		for(i=0; i<eqCount; i++)
+			for(j=0; j<=eqCount; j++)
+				setCoefficient((unsigned short int)(i+1), (unsigned short int)(j+1), values[((UINT64) i * (eqCount+1) + j)]);
+		return 1;
+	}
+
+	if(!prepareLoad(1))
+		return 0;
+
+	count = (UINT64) eqCount * (eqCount+1);
+	if(compactNumerator != NULL)
+	{
+		memcpy(compactNumerator, values, (size_t) count * sizeof(short int));
+		if(compactDenominator != NULL)
+			releaseMemory(compactDenominator);	/* All Integers Now */
+		compactDenominator = NULL;
+		return 1;
+	}
+
+	for(i=0; i<eqCount; i++)
+		for(j=0; j<=eqCount; j++)
+			originalCoefficient[i][j] = widenCompact(values, NULL, (UINT64) i * (eqCount+1) + j);
+
+	return 1;
+}
+
+/*	The purpose of this function is to set every coefficient at once
+	from 32-bit values, see setCoefficients(). A system whose values
+	all lie within -32768 .. 32767 stays in compact storage; otherwise
+	the "original" matrix is held as fractions.
+
+	Parameters: 
+		values - eqCount x (eqCount+1) coefficients, row-major
+
+	Returns:
+		1 on success
+		0 in case of an error (system not dimensioned, memory
+		allocation errors)
+*/
+unsigned int eqsolver::setCoefficients(const int *values)
+{
+	return loadIntegers(values, NULL);
+}
+
+/*	The purpose of this function is to set every coefficient at once
+	from 64-bit values, see setCoefficients(). Fractions hold 32 bits
+	of magnitude, so values must lie within -4294967295 .. 4294967295.
+
+	Parameters: 
+		values - eqCount x (eqCount+1) coefficients, row-major
+
+	Returns:
+		1 on success
+		0 in case of an error (system not dimensioned, a value out of
+		range (nothing is changed then), memory allocation errors)
+*/
+unsigned int eqsolver::setCoefficients(const INT64 *values)
+{
+	return loadIntegers(NULL, values);
+}
+
+/*	The purpose of this function is to set every coefficient at once
+	in fraction form, as setCoefficientFraction() would, see
+	setCoefficients(). Denominators are only kept if some value is not
+	an integer.
+
+	Parameters: 
+		numerators - eqCount x (eqCount+1) numerators, row-major
+		denominators - their denominators, laid out alike
+
+	Returns:
+		1 on success
+		0 in case of an error (system not dimensioned, memory
+		allocation errors)
+*/
+unsigned int eqsolver::setCoefficientsFraction(const short int *numerators, const short int *denominators)
+{
+	UINT64 count, k;
+	unsigned int i, j;
+	int integral;
+
+	if((bandCoefficient != NULL) || (symmetricCoefficient != NULL) || (structureType != STRUCTURE_NONE))
+	{
+		for(i=0; i<eqCount; i++)
+		{
+			k = (UINT64) i * (eqCount+1);
+			for(j=0; j<=eqCount; j++)
+				setCoefficientFraction((unsigned short int)(i+1), (unsigned short int)(j+1), numerators[(k+j)], denominators[(k+j)]);
+		}
+		return 1;
+	}
+
+	if(!prepareLoad(1))
+		return 0;
+
+	count = (UINT64) eqCount * (eqCount+1);
+	if(compactNumerator != NULL)
+	{
+		integral = 1;
+		for(k=0; (k<count) && integral; k++)
+			integral = integerPair(numerators[k], denominators[k]);
+
+		if(!integral && (compactDenominator == NULL))
+		{
+			compactDenominator = (short int *) allocateMemory((size_t) count * sizeof(short int));
+			if(compactDenominator == NULL)
+				return 0;
+		}
+
+		memcpy(compactNumerator, numerators, (size_t) count * sizeof(short int));
+		if(!integral)
+			memcpy(compactDenominator, denominators, (size_t) count * sizeof(short int));
+		else if(compactDenominator != NULL)
+		{
+			releaseMemory(compactDenominator);
+			compactDenominator = NULL;
+		}
+		return 1;
+	}
+
+	for(i=0; i<eqCount; i++)
+		for(j=0; j<=eqCount; j++)
+			originalCoefficient[i][j] = widenCompact(numerators, denominators, (UINT64) i * (eqCount+1) + j);
+
+	return 1;
+}
+
+/*	The purpose of this function is to set every coefficient at once
+	from fractions of 32-bit integers, see setCoefficientsFraction(const
+	INT64 *, const INT64 *).
+
+	Parameters: 
+		numerators - eqCount x (eqCount+1) numerators, row-major
+		denominators - their denominators, laid out alike
+
+	Returns:
+		Same as setCoefficientsFraction(const INT64 *, const INT64 *).
+*/
+unsigned int eqsolver::setCoefficientsFraction(const int *numerators, const int *denominators)
+{
+	return loadRationals(numerators, denominators, NULL, NULL);
+}
+
+/*	The purpose of this function is to set every coefficient at once
+	from fractions of 64-bit integers, see setCoefficients(). Each
+	fraction is reduced, as by setCoefficientFraction64(). A system
+	whose reduced values all fit 16 bits stays in compact storage;
+	otherwise the "original" matrix is held as 32-bit fractions.
+
+	Parameters: 
+		numerators - eqCount x (eqCount+1) numerators, row-major
+		denominators - their denominators, laid out alike
+
+	Returns:
+		1 on success
+		0 in case of an error (system not dimensioned, a reduced
+		numerator or denominator above 4294967295 (nothing is changed
+		then), memory allocation errors)
+*/
+unsigned int eqsolver::setCoefficientsFraction(const INT64 *numerators, const INT64 *denominators)
+{
+	return loadRationals(NULL, NULL, numerators, denominators);
+}
+
+/*	The purpose of this function is to make storage ready for one of
+	the bulk loaders (setCoefficients() ..): regular storage, as
+	fractions unless the values fit compact storage. The altered
+	matrix, factorization and absorbed equations are dropped, as all
+	values are about to change.
+
+	Parameters: 
+		compact - 1 = values fit compact storage (16-bit integers or
+				pairs)
+
+	Returns:
+		1 on success, 0 if the system is not dimensioned or on
+		allocation errors.
+*/
+int eqsolver::prepareLoad(int compact)
+{
+	if(eqCount == 0)
+		return 0;	/* System Not Dimensioned */
+
+	if(!expandStorage() || (!compact && !widenOriginal()))
+		return 0;
+
+	releaseFactorization();	/* Inverse No Longer Matches */
+
+	/* Altered Matrix Would Equal The Original Again */
+	destroyMatrix(coefficient);
+	coefficient = NULL;
+	streamRank = 0;
+	streamStatus = 0;
+
+	return 1;
+}
+
+/*	The purpose of this function is to load integers of up to 64 bits
+	for setCoefficients(). The values are checked in one pass first,
+	for their range and whether compact storage can hold them.
+
+	Parameters: 
+		values32 - 32-bit values, or NULL
+		values64 - 64-bit values if values32 is NULL
+
+	Returns:
+		Same as setCoefficients(const INT64 *).
+*/
+unsigned int eqsolver::loadIntegers(const int *values32, const INT64 *values64)
+{
+	UINT64 count, k;
+	INT64 value;
+	unsigned int i, j;
+	int small;	/* 1 = All Fit 16 Bits */
+
+	if(eqCount == 0)
+		return 0;
+
+	count = (UINT64) eqCount * (eqCount+1);
+	small = 1;
+	for(k=0; k<count; k++)
+	{
+		value = (values32 != NULL) ? (INT64) values32[k] : values64[k];
+		if((value > UINT32MAX) || (value < -UINT32MAX))
+			return 0;	/* Too Large For A Fraction */
+		if((value > 32767) || (value < -32768))
+			small = 0;
+	}
+
+	if(small && ((bandCoefficient != NULL) || (symmetricCoefficient != NULL) || (structureType != STRUCTURE_NONE)))
+	{
+		for(i=0; i<eqCount; i++)
+		{
+			k = (UINT64) i * (eqCount+1);
+			for(j=0; j<=eqCount; j++)
+				setCoefficient((unsigned short int)(i+1), (unsigned short int)(j+1), (short int) ((values32 != NULL) ? (INT64) values32[(k+j)] : values64[(k+j)]));
+		}
+		return 1;
+	}
+
+	if(!prepareLoad(small))
+		return 0;
+
+	if(compactNumerator != NULL)
+	{
+		if(values32 != NULL)
+			for(k=0; k<count; k++)
+				compactNumerator[k] = (short int) values32[k];
+		else
+			for(k=0; k<count; k++)
+				compactNumerator[k] = (short int) values64[k];
+		if(compactDenominator != NULL)
+			releaseMemory(compactDenominator);	/* All Integers Now */
+		compactDenominator = NULL;
+		return 1;
+	}
+
+	for(i=0; i<eqCount; i++)
+	{
+		k = (UINT64) i * (eqCount+1);
+		for(j=0; j<=eqCount; j++)
+			originalCoefficient[i][j] = integerFraction((values32 != NULL) ? (INT64) values32[(k+j)] : values64[(k+j)]);
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to load fractions of up to 64-bit
+	integers for setCoefficientsFraction(). The values are reduced &
+	checked in one pass first, for their range and whether compact
+	storage can hold them, then reduced again as they are stored.
+
+	Parameters: 
+		numerators32, denominators32 - 32-bit values, or NULL
+		numerators64, denominators64 - 64-bit values if numerators32 is NULL
+
+	Returns:
+		Same as setCoefficientsFraction(const INT64 *, const INT64 *).
+*/
+unsigned int eqsolver::loadRationals(const int *numerators32, const int *denominators32, const INT64 *numerators64, const INT64 *denominators64)
+{
+	UINT64 count, k;
+	unsigned int i, j;
+	struct fraction value;
+	int small;	/* 1 = All Fit 16 Bits */
+	int integral;	/* 1 = No Denominator Needed */
+
+	if(eqCount == 0)
+		return 0;
+
+	count = (UINT64) eqCount * (eqCount+1);
+	small = integral = 1;
+	for(k=0; k<count; k++)
+	{
+		if(numerators32 != NULL)
+		{
+			if(!reduceRational(numerators32[k], denominators32[k], value))
+				return 0;	/* Too Large For A Fraction */
+		}
+		else if(!reduceRational(numerators64[k], denominators64[k], value))
+			return 0;
+
+		if(!narrowFraction(value))
+			small = 0;
+		if(value.denominator > 1)
+			integral = 0;
+	}
+
+	if(small && ((bandCoefficient != NULL) || (symmetricCoefficient != NULL) || (structureType != STRUCTURE_NONE)))
+	{
+		for(i=0; i<eqCount; i++)
+		{
+			k = (UINT64) i * (eqCount+1);
+			for(j=0; j<=eqCount; j++)
+			{
+				if(numerators32 != NULL)
+					reduceRational(numerators32[(k+j)], denominators32[(k+j)], value);
+				else
+					reduceRational(numerators64[(k+j)], denominators64[(k+j)], value);
+				setCoefficientFraction((unsigned short int)(i+1), (unsigned short int)(j+1), narrowNumerator(value), (short int) value.denominator);
+			}
+		}
+		return 1;
+	}
+
+	if(!prepareLoad(small))
+		return 0;
+
+	/* Reduced Values Fit Compact Storage, Denominators Only If Needed */
+	if(compactNumerator != NULL)
+	{
+		if(!integral && (compactDenominator == NULL))
+		{
+			compactDenominator = (short int *) allocateMemory((size_t) count * sizeof(short int));
+			if(compactDenominator == NULL)
+				return 0;
+		}
+		else if(integral && (compactDenominator != NULL))
+		{
+			releaseMemory(compactDenominator);
+			compactDenominator = NULL;
+		}
+
+		for(k=0; k<count; k++)
+		{
+			if(numerators32 != NULL)
+				reduceRational(numerators32[k], denominators32[k], value);
+			else
+				reduceRational(numerators64[k], denominators64[k], value);
+
+			compactNumerator[k] = narrowNumerator(value);
+			if(compactDenominator != NULL)
+				compactDenominator[k] = (short int) value.denominator;
+		}
+		return 1;
+	}
+
+	for(i=0; i<eqCount; i++)
+	{
+		k = (UINT64) i * (eqCount+1);
+		for(j=0; j<=eqCount; j++)
+		{
+			if(numerators32 != NULL)
+				reduceRational(numerators32[(k+j)], denominators32[(k+j)], originalCoefficient[i][j]);
+			else
+				reduceRational(numerators64[(k+j)], denominators64[(k+j)], originalCoefficient[i][j]);
+		}
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to retrieve the value of the
+	specified unaltered matrix coefficient (returned in fraction form).
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1)
+		coefficientValue - reference to an integer		
+
+	Returns:
+		In case of error (out of bound matrix positioning), the
+		function simply returns 0. Otherwise the value is returned.
+*/
+int eqsolver::getOriginalMatrixCoefficient(unsigned short int row, unsigned short int column)
+{
+	int coefficientValue;
+	struct fraction value;
+	
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+		return 0;	/* Out Of Bounds, Simply Return, Note coefficientValue remains unchanged */
+	
+	value = originalValue((row-1), (column-1));
+
+	coefficientValue = value.numerator;
+	
+	if(value.sign == 1)
+		coefficientValue = coefficientValue * -1;
+
+	return coefficientValue;
+}
+
+/* Same As Above, Slightly Modified */
+void eqsolver::getOriginalMatrixCoefficientFraction(unsigned int row, unsigned short int column,
+												  int *numerator, int *denominator)
+{	
+	struct fraction value;
+
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+	{
+		*numerator = *denominator = 0;	
+		return;	/* Out Of Bounds, Simply Return, Note coefficientValue remains unchanged */
+	}
+
+	value = originalValue((row-1), (column-1));
+
+	*numerator = value.numerator;
+	
+	if(value.sign == 1)
+		*numerator = *numerator * -1;
+
+	*denominator = value.denominator;
+}
+
+/*	The purpose of this function is to retrieve the value of the
+	specified altered matrix coefficient (returned in fraction form).
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1)
+		coefficientValue - reference to fraction structure (stores result)		
+
+	Returns:
+		In case of error (out of bound matrix positioning), the
+		function simply returns.
+*/
+void eqsolver::getAlteredMatrixCoefficient(unsigned short row, unsigned short column, struct fraction &coefficientValue)
+{
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+		return;	/* Out Of Bounds, Simply Return */
+
+	/* Nothing Altered Yet */
+	if(coefficient == NULL)
+	{
+		coefficientValue = originalValue((row-1), (column-1));
+		return;
+	}
+	
+	coefficientValue.numerator = coefficient[(row-1)][(column-1)].numerator;
+	coefficientValue.denominator = coefficient[(row-1)][(column-1)].denominator;
+	coefficientValue.sign = coefficient[(row-1)][(column-1)].sign;
+}
+
+/*	The purpose of this function is to swap the specified matrix
+	rows (this is used during the Gauss-Jordan algorithm). Since
+	the only memory locations altered are 2 pointers, this swap
+	method is extremely efficient.
+
+	Parameters: 
+		row1, row2 - rows to swap
+		coeffPtr - pointer to coefficient data structure in which you
+					wish to swap rows
+
+	Returns:
+		In case of error (out of bound matrix positioning), the
+		function simply returns without altering any memory.
+*/
+void eqsolver::swapRows(unsigned short int row1, unsigned short int row2, struct fraction **coeffPtr)
+{
+	struct fraction *temp;	/* Swap Address Holder */
+
+	if((row1 < 1) || (row2 < 1) || (row1 > eqCount) || (row2 > eqCount))
+		return;	/* Out Of Bounds */
+
+	/* Swap Row Pointers */
+	temp = coeffPtr[(row1-1)];
+	coeffPtr[(row1-1)] = coeffPtr[(row2-1)];
+	coeffPtr[(row2-1)] = temp;
+}
+
+/*	The purpose of this function is reduce the specified fraction
+	to its lowest possible form.
+
+	Parameters: 
+		unreducedFraction - fraction to reduce
+
+	Returns:
+		The result of the reduction is returned.
+*/
+struct fraction eqsolver::reduce(struct fraction unreducedFraction)
+{
+	struct fraction result;
+	unsigned int gcf, num1, num2, temp;	/* Greatest Common Factor Solving */
+
+	/* First Check If the unreducedFraction = 0 */
+	/* The 2nd half of this condition is not needed, but added as a 
+		precautionary measure to ENSURE non-divide-by-zero. */
+	if((unreducedFraction.numerator == 0) || (unreducedFraction.denominator == 0))
+	{
+		result.numerator = 0;
+		result.denominator = 0;
+		result.sign = 0;
+		return result;
+	}
+	
+	/* Next Check If The unreducedFraction = 1 */
+	if(unreducedFraction.numerator == unreducedFraction.denominator)
+	{
+		result.numerator = 1;
+		result.denominator = 1;
+		result.sign = unreducedFraction.sign;
+		return result;
+	}
+	
+	num1 = unreducedFraction.numerator;
+	num2 = unreducedFraction.denominator;
+		
+	/* Determine The Greatest Common Factor (Using Euclid's Algorithm) */
+	while (num2)
+	{
+		temp = num1;	
+		num1 = num2;
+		num2 = temp % num2;
+	}
+
+	gcf = num1;
+
+	result.numerator = unreducedFraction.numerator / gcf;
+	result.denominator = unreducedFraction.denominator / gcf;
+	result.sign = unreducedFraction.sign;
+
+	return result;
+}
+
+/*	The purpose of this function is to divide two "fraction" values
+	and return the result to the caller.
+
+	Parameters: 
+		dividend - fraction which will be divided
+		divisor - fraction by which to divide the dividend
+
+	Returns:
+		The result of the calculation is returned. Note zero-division
+		is checked but should still be handled by the caller. If a 
+		zero-division occurs, the dividend is returned unaltered.
+*/
+struct fraction eqsolver::divide(struct fraction dividend, struct fraction divisor)
+{
+	UINT64 overflowCheck;
+	struct fraction result;
+	
+	/* Accomplish Division By Reciprocal Multiplication */
+	
+	/* Calculate Numerator */
+	overflowCheck = (UINT64)dividend.numerator * (UINT64)divisor.denominator;
+	if(overflowCheck > UINT32MAX)
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		result.numerator = 0;
+		result.denominator = 0;
+		result.sign = 0;
+		return result;
+	}
+
+	result.numerator = dividend.numerator * divisor.denominator;
+
+	/* Calculate Denominator */
+	overflowCheck = (UINT64)dividend.denominator * (UINT64)divisor.numerator;
+	if(overflowCheck > UINT32MAX)
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		result.numerator = 0;
+		result.denominator = 0;
+		result.sign = 0;
+		return result;
+	}
+
+	result.denominator = dividend.denominator * divisor.numerator;
+
+	/* Prevent Divide By Zero (Should Not Happen If Called Properly) */
+	if((result.numerator != 0) && (result.denominator == 0))
+		return dividend;	/* Return The Dividend Unaltered */
+	
+	/* Set Sign */
+	if(dividend.sign == 1)	/* Dividend Negative? */
+	{
+		if(divisor.sign == 1)	/* Divisor Also Negative? */
+			result.sign = 0;	/* Negative/Negative = Positive */
+		else
+			result.sign = 1;	/* Negative/Positive = Negative */
+	}
+	else	/* Dividend Positive */
+	{
+		if(divisor.sign == 1)	/* Divisor Negative? */
+			result.sign = 1;	/* Positive/Negative = Negative */
+		else
+			result.sign = 0;	/* Positive/Positive = Positive */
+	}
+	
+	/* Reduce Result */
+	result = reduce(result);
+
+	return result;
+}
+
+/*	The purpose of this function is to multiply two "fraction" values
+	and return the result to the caller.
+
+	Parameters: 
+		fraction1 - fraction to by multiplied
+		fraction2 - fraction to be multiplied by
+
+	Returns:
+		The result of the calculation is returned. Note zero-division
+		is checked but should still be handled by the caller. If a 
+		zero-division occurs, fraction1 is returned unaltered.
+*/
+struct fraction eqsolver::multiply(struct fraction fraction1, struct fraction fraction2)
+{
+	UINT64 overflowCheck;
+	struct fraction result;
+	
+	/* Calculate Numerator */
+	overflowCheck = (UINT64)fraction1.numerator * (UINT64)fraction2.numerator;
+	if(overflowCheck > UINT32MAX)
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		result.numerator = 0;
+		result.denominator = 0;
+		result.sign = 0;
+		return result;
+	}
+
+	result.numerator = fraction1.numerator * fraction2.numerator;
+
+	/* Calculate Denominator */
+	overflowCheck = (UINT64)fraction1.denominator * (UINT64)fraction2.denominator;
+	if(overflowCheck > UINT32MAX)
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		result.numerator = 0;
+		result.denominator = 0;
+		result.sign = 0;
+		return result;
+	}
+
+	result.denominator = fraction1.denominator * fraction2.denominator;
+
+	/* Prevent Divide By Zero (Should Not Happen If Called Properly) */
+	if((result.numerator != 0) && (result.denominator == 0))
+		return fraction1;	/* Return fraction1  Unaltered */
+
+	/* Set Sign */
+	if(fraction1.sign == 1)	/* fraction1 Negative? */
+	{
+		if(fraction2.sign == 1)	/* fraction2 Also Negative? */
+			result.sign = 0;	/* Negative*Negative = Positive */
+		else
+			result.sign = 1;	/* Negative*Positive = Negative */
+	}
+	else	/* Dividend Positive */
+	{
+		if(fraction2.sign == 1)	/* fraction2 Negative? */
+			result.sign = 1;	/* Positive*Negative = Negative */
+		else
+			result.sign = 0;	/* Positive*Positive = Positive */
+	}
+
+	/* Reduce Result */
+	result = reduce(result);
+
+	return result;
+}
+
+/*	The purpose of this function is to add two "fraction" values
+	and return the result to the caller.
+
+	Parameters: 
+		fraction1, fraction 2 - fractions to be added
+
+	Returns:
+		The result of the calculation is returned. Note zero-division
+		is checked but should still be handled by the caller. If a 
+		zero-division occurs, fraction1 is returned unaltered.
+*/
+struct fraction eqsolver::add(struct fraction fraction1, struct fraction fraction2)
+{
+	UINT64 overflowCheck;
+	INT64 overflowCheckWithSign, num1OverflowCheckWithSign, num2OverflowCheckWithSign;
+	int num1, num2, resultNum;
+	struct fraction result;
+	
+	/* Verify Niether Fraction Is 0 */
+	if((fraction1.numerator == 0) && (fraction1.denominator == 0))
+		return fraction2;
+
+	if((fraction2.numerator == 0) && (fraction2.denominator == 0))
+		return fraction1;
+
+	/* Do Calculations Here */
+	/* Set Numerator */
+
+	/* Are Both Numerators Positive? */
+	if((fraction1.sign == 0) && (fraction2.sign == 0))
+	{
+		/* Stay In True Unsigned 32-bit Representation */
+		overflowCheck = ((UINT64)fraction1.numerator * (UINT64)fraction2.denominator) + ((UINT64)fraction2.numerator * (UINT64)fraction1.denominator);
+		if(overflowCheck > UINT32MAX)
+		{
+			overFlow = 1;	/* Set Overflow Flag */
+			result.numerator = 0;
+			result.denominator = 0;
+			result.sign = 0;
+			return result;
+		}
+		result.numerator = (fraction1.numerator * fraction2.denominator) + (fraction2.numerator * fraction1.denominator);
+		result.sign = 0;
+	}
+	else	/* One Of The Numbers Is Negative */
+	{
+		/* First Check For Overflow In Necessary Calculations */
+		if(fraction1.sign == 1)
+		{
+			num1OverflowCheckWithSign = (INT64)fraction1.numerator * -1;
+			if(num1OverflowCheckWithSign < INT32MIN)
+			{
+				
+				overFlow = 1;	/* Set Overflow Flag */
+				result.numerator = 0;
+				result.denominator = 0;
+				result.sign = 0;
+				return result;
+			}
+		}
+		else
+		{
+			num1OverflowCheckWithSign = (INT64)fraction1.numerator;
+			if(num1OverflowCheckWithSign > INT32MAX)
+			{
+				
+				overFlow = 1;	/* Set Overflow Flag */
+				result.numerator = 0;
+				result.denominator = 0;
+				result.sign = 0;
+				return result;
+			}
+		}
+		if(fraction2.sign == 1)
+		{
+			num2OverflowCheckWithSign = (INT64)fraction2.numerator * -1;
+			if(num2OverflowCheckWithSign < INT32MIN)
+			{
+				overFlow = 1;	/* Set Overflow Flag */
+				result.numerator = 0;
+				result.denominator = 0;
+				result.sign = 0;
+				return result;
+			}
+		}
+		else
+		{
+			num2OverflowCheckWithSign = (INT64)fraction2.numerator;
+			if(num1OverflowCheckWithSign > INT32MAX)
+			{
+				overFlow = 1;	/* Set Overflow Flag */
+				result.numerator = 0;
+				result.denominator = 0;
+				result.sign = 0;
+				return result;
+			}
+		}
+		
 		overflowCheckWithSign = num1OverflowCheckWithSign * fraction2.denominator;
 		if((overflowCheckWithSign > INT32MAX) || (overflowCheckWithSign < INT32MIN))
 		{
-			overFlow = 1;	/* Set Overflow Flag */
-			result.numerator = 0;
-			result.denominator = 0;
-			result.sign = 0;
-			return result;
+			overFlow = 1;	/* Set Overflow Flag */
+			result.numerator = 0;
+			result.denominator = 0;
+			result.sign = 0;
+			return result;
+		}
+
+		overflowCheckWithSign = num2OverflowCheckWithSign * fraction1.denominator;
+		if((overflowCheckWithSign > INT32MAX) || (overflowCheckWithSign < INT32MIN))
+		{
+			overFlow = 1;	/* Set Overflow Flag */
+			result.numerator = 0;
+			result.denominator = 0;
+			result.sign = 0;
+			return result;
+		}
+
+		overflowCheckWithSign = (num1OverflowCheckWithSign * fraction2.denominator) + (num2OverflowCheckWithSign * fraction1.denominator);
+		if((overflowCheckWithSign > INT32MAX) || (overflowCheckWithSign < INT32MIN))
+		{
+			overFlow = 1;	/* Set Overflow Flag */
+			result.numerator = 0;
+			result.denominator = 0;
+			result.sign = 0;
+			return result;
+		}
+
+		/* Drop Down To Signed 32-bit Representation, Lose 1 Bit Of Size */
+		if(fraction1.sign == 1)
+			num1 = fraction1.numerator * -1;
+		else
+			num1 = fraction1.numerator;
+		if(fraction2.sign == 1)
+			num2 = fraction2.numerator * -1;
+		else
+			num2 = fraction2.numerator;
+
+		resultNum = (num1 * fraction2.denominator) + (num2 * fraction1.denominator);
+		if(resultNum < 0)
+			result.sign = 1;
+		else
+			result.sign = 0;
+
+		result.numerator = abs(resultNum);
+	}
+
+	/* Set Denominator */
+	overflowCheck = (UINT64)fraction1.denominator * (UINT64)fraction2.denominator;
+	if(overflowCheck > UINT32MAX)
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		result.numerator = 0;
+		result.denominator = 0;
+		result.sign = 0;
+		return result;
+	}
+
+	result.denominator = fraction1.denominator * fraction2.denominator;
+
+	/* Prevent Divide By Zero (Should Not Happen If Called Properly) */
+	if((result.numerator != 0) && (result.denominator == 0))
+		return fraction1;	/* Return fraction1  Unaltered */
+
+	/* Reduce Result */
+	result = reduce(result);
+
+	return result;
+}
+
+/*	The purpose of this function is to multiply a row in the specified 
+	matrix by the specified fraction value.
+
+	Parameters: 
+		row - matrix row to be multiplied
+		multiplier - fraction value by which to multiply
+		coeffPtr - matrix to operate on
+
+	Returns:
+		Returns nothing. If row is out of bounds the function returns 
+		without altering any memory. 
+*/
+void eqsolver::multiplyMatrixRow(unsigned short int row, struct fraction multiplier, struct fraction **coeffPtr)
+{
+	unsigned int column;
+	
+	/* Perform Bounds Checking */
+	if((row < 1) || (row > eqCount))
+		return;	/* Out Of Bounds, Return */
+
+	/* Multiply Each Value In Specified Row By "multiplier" Fraction */
+	for(column=0; column<=eqCount; column++)
+	{
+		coeffPtr[(row-1)][column] = multiply(coeffPtr[(row-1)][column], multiplier);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to divide a row in the specified
+	matrix by the specified fraction value.
+
+	Parameters: 
+		row - matrix row to be divided
+		divisor - fraction value by which to divide
+		coeffPtr - matrix to operate on
+
+	Returns:
+		Returns nothing. If row is out of bounds the function returns 
+		without altering any memory. 
+*/
+void eqsolver::divideMatrixRow(unsigned short int row, struct fraction divisor, struct fraction **coeffPtr)
+{
+	unsigned int column;
+	
+	/* Perform Bounds Checking */
+	if((row < 1) || (row > eqCount))
+		return;	/* Out Of Bounds, Return */
+
+	/* Divide Each Value In Specified Row By "divisor" Fraction */
+	for(column=0; column<=eqCount; column++)
+	{
+		coeffPtr[(row-1)][column] = divide(coeffPtr[(row-1)][column], divisor);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to add a row to another row
+	in the specified matrix.
+
+	Parameters: 
+		row - matrix row to be added to
+		rowToAdd - matrix row to add
+		coeffPtr - matrix to operate on
+
+	Returns:
+		Returns nothing. If row is out of bounds the function returns 
+		without altering any memory. 
+*/
+void eqsolver::addMatrixRows(unsigned short int row, unsigned short int rowToAdd, struct fraction **coeffPtr)
+{
+	unsigned int column;
+	
+	/* Perform Bounds Checking */
+	if((row < 1) || (row > eqCount) || (rowToAdd < 1) || (rowToAdd > eqCount))
+		return;	/* Out Of Bounds, Return */
+
+	/* Add Each Value In Specified rowToAdd To row */
+	for(column=0; column<=eqCount; column++)
+	{
+		coeffPtr[(row-1)][column] = add(coeffPtr[(row-1)][column], coeffPtr[(rowToAdd-1)][column]);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to determine the greatest common
+	factor of two unsigned 64-bit values (using Euclid's Algorithm).
+
+	Parameters: 
+		value1, value2 - values to factor
+
+	Returns:
+		The greatest common factor. If either value is 0 the other
+		value is returned.
+*/
+UINT64 eqsolver::gcd64(UINT64 value1, UINT64 value2)
+{
+	UINT64 temp;
+
+	while(value2)
+	{
+		temp = value1;
+		value1 = value2;
+		value2 = temp % value2;
+	}
+
+	return value1;
+}
+
+/*	The purpose of this function is to multiply two signed 64-bit
+	values while checking for overflow. The magnitude INT64MAX+1 is
+	treated as an overflow so results may always be negated safely.
+
+	Parameters: 
+		value1, value2 - values to multiply
+		result - reference to storage for the product
+
+	Returns:
+		1 on success
+		0 on overflow (overFlow is also set, result is unaltered)
+*/
+int eqsolver::multiply64(INT64 value1, INT64 value2, INT64 &result)
+{
+	UINT64 magnitude1, magnitude2;
+
+	magnitude1 = (value1 < 0) ? ((UINT64)(-(value1+1)) + 1) : (UINT64)value1;
+	magnitude2 = (value2 < 0) ? ((UINT64)(-(value2+1)) + 1) : (UINT64)value2;
+
+	if((magnitude1 != 0) && (magnitude2 > ((UINT64)INT64MAX / magnitude1)))
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		return 0;
+	}
+
+	result = value1 * value2;
+	return 1;
+}
+
+/*	The purpose of this function is to subtract two signed 64-bit
+	values (value1 - value2) while checking for overflow.
+
+	Parameters: 
+		value1 - value to subtract from
+		value2 - value to subtract
+		result - reference to storage for the difference
+
+	Returns:
+		1 on success
+		0 on overflow (overFlow is also set, result is unaltered)
+*/
+int eqsolver::subtract64(INT64 value1, INT64 value2, INT64 &result)
+{
+	if(((value2 > 0) && (value1 < (-INT64MAX + value2))) ||
+		((value2 < 0) && (value1 > (INT64MAX + value2))))
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		return 0;
+	}
+
+	result = value1 - value2;
+	return 1;
+}
+
+/*	The purpose of this function is to create an integer copy of the
+	N x N "original" matrix (the RHS column is not copied). Each row is
+	multiplied by the least common multiple of its denominators so the
+	copy holds integers only, which is what the fraction-free
+	elimination requires.
+
+	Parameters: 
+		rowScale - array of eqCount values which receives the factor
+					each row was multiplied by
+
+	Returns:
+		Pointer to the integer matrix on success. NULL on memory
+		allocation errors or on overflow (overFlow is set).
+*/
+INT64 **eqsolver::createIntegerMatrix(INT64 *rowScale)
+{
+	INT64 **intPtr;
+	INT64 multiple, value;
+	UINT64 factor;
+	unsigned int i, j;
+	struct fraction entry;
+
+	intPtr = (INT64 **) allocateMemory(eqCount * sizeof(INT64 *));
+	if(intPtr == NULL)
+		return NULL;
+
+	for(i=0; i<eqCount; i++)
+		intPtr[i] = NULL;
+
+	for(i=0; i<eqCount; i++)
+	{
+		intPtr[i] = (INT64 *) allocateMemory(eqCount * sizeof(INT64));
+		if(intPtr[i] == NULL)
+		{
+			destroyIntegerMatrix(intPtr);
+			return NULL;
+		}
+
+		/* Least Common Multiple Of Row Denominators */
+		multiple = 1;
+		for(j=0; j<eqCount; j++)
+		{
+			entry = originalValue(i, j);
+			if(entry.numerator == 0)
+				continue;	/* Zero, Denominator Is Meaningless */
+
+			factor = (UINT64)entry.denominator / gcd64((UINT64)multiple, (UINT64)entry.denominator);
+			if(!multiply64(multiple, (INT64)factor, multiple))
+			{
+				destroyIntegerMatrix(intPtr);
+				return NULL;
+			}
+		}
+
+		rowScale[i] = multiple;
+
+		/* Scale Row */
+		for(j=0; j<eqCount; j++)
+		{
+			entry = originalValue(i, j);
+			if(entry.numerator == 0)
+			{
+				intPtr[i][j] = 0;
+				continue;
+			}
+
+			if(!multiply64((INT64)entry.numerator, multiple / (INT64)entry.denominator, value))
+			{
+				destroyIntegerMatrix(intPtr);
+				return NULL;
+			}
+
+			intPtr[i][j] = (entry.sign == 1) ? -value : value;
+		}
+	}
+
+	return intPtr;
+}
+
+/*	The purpose of this function is to deallocate an integer matrix
+	created by createIntegerMatrix().
+
+	Parameters: 
+		intPtr - integer matrix to deallocate (may be NULL)
+
+	Returns:
+		None
+*/
+void eqsolver::destroyIntegerMatrix(INT64 **intPtr)
+{
+	unsigned int i;
+
+	if(intPtr == NULL)
+		return;
+
+	for(i=0; i<eqCount; i++)
+		if(intPtr[i] != NULL)
+			releaseMemory(intPtr[i]);
+
+	releaseMemory(intPtr);
+}
+
+/*	The purpose of this function is to reduce an N x N integer matrix
+	to upper triangular form using fraction-free (Bareiss) elimination.
+	Every intermediate value is a minor of the input, so the divisions
+	are exact and no fractions (or GCDs) are needed. Columns without a
+	pivot are skipped, the number of pivots found being the rank.
+	When the matrix has full rank the last pivot is the determinant
+	of the row-swapped matrix.
+
+	Parameters: 
+		intPtr - integer matrix to operate on
+		stopOnDeficiency - if nonzero, return as soon as a column without
+					a pivot is found (the matrix is then known to be singular)
+		rowSwaps - receives the number of row swaps performed
+
+	Returns:
+		The number of pivots found. If an overflow occurs overFlow is
+		set and the function returns immediately.
+*/
+unsigned short int eqsolver::fractionFreeEliminate(INT64 **intPtr, int stopOnDeficiency, unsigned int &rowSwaps)
+{
+	unsigned int row, column, i, j;
+	INT64 previousPivot, product1, product2;
+	INT64 *temp;
+
+	rowSwaps = 0;
+	previousPivot = 1;
+	row = 0;
+
+	for(column=0; (column<eqCount) && (row<eqCount); column++)
+	{
+		/* Locate Pivot At Or Below Current Row */
+		for(i=row; i<eqCount; i++)
+			if(intPtr[i][column] != 0)
+				break;
+
+		if(i == eqCount)	/* No Pivot, Matrix Is Singular */
+		{
+			if(stopOnDeficiency)
+				return (unsigned short int) row;
+			continue;
+		}
+
+		if(i != row)
+		{
+			temp = intPtr[i];
+			intPtr[i] = intPtr[row];
+			intPtr[row] = temp;
+			rowSwaps++;
+		}
+
+		/* Eliminate Below Pivot */
+		for(i=row+1; i<eqCount; i++)
+		{
+			for(j=column+1; j<eqCount; j++)
+			{
+				if(!multiply64(intPtr[row][column], intPtr[i][j], product1))
+					return (unsigned short int) row;
+				if(!multiply64(intPtr[i][column], intPtr[row][j], product2))
+					return (unsigned short int) row;
+				if(!subtract64(product1, product2, product1))
+					return (unsigned short int) row;
+
+				intPtr[i][j] = product1 / previousPivot;	/* Exact Division */
+			}
+			intPtr[i][column] = 0;
+		}
+
+		previousPivot = intPtr[row][column];
+		row++;
+	}
+
+	return (unsigned short int) row;
+}
+
+/*	The purpose of this function is to swap the altered matrix
+	rows (this is used during the Gauss-Jordan algorithm). Since
+	the only memory locations altered are 2 pointers, this swap
+	method is extremely efficient. Note this is an overloaded version
+	of the private method swapRows().
+
+	Parameters: 
+		row1, row2 - rows to swap
+
+	Returns:
+		In case of error (out of bound matrix positioning), the
+		function simply returns without altering any memory.
+*/
+void eqsolver::swapRows(unsigned short int row1, unsigned short int row2)
+{
+	struct fraction *temp;	/* Swap Address Holder */
+
+	if((row1 < 1) || (row2 < 1) || (row1 > eqCount) || (row2 > eqCount))
+		return;	/* Out Of Bounds */
+
+	if(!expandStorage() || !prepareAltered())
+		return;	/* Altered Matrix Needs Regular Storage */
+
+	/* Swap Row Pointers */
+	temp = coefficient[(row1-1)];
+	coefficient[(row1-1)] = coefficient[(row2-1)];
+	coefficient[(row2-1)] = temp;
+}
+
+/*	The purpose of this function is to multiply a row in the altered
+	matrix by the specified fraction value. Note this is an overloaded
+	version of the private method multiplyMatrixRow().
+
+	Parameters: 
+		row - matrix row to be multiplied
+		multiplier - fraction value by which to multiply
+
+	Returns:
+		Returns nothing. If row is out of bounds the function returns 
+		without altering any memory. 
+*/
+void eqsolver::multiplyMatrixRow(unsigned short int row, struct fraction multiplier)
+{
+	unsigned int column;
+	
+	/* Perform Bounds Checking */
+	if((row < 1) || (row > eqCount))
+		return;	/* Out Of Bounds, Return */
+
+	if(!expandStorage() || !prepareAltered())
+		return;	/* Altered Matrix Needs Regular Storage */
+
+	/* Multiply Each Value In Specified Row By "multiplier" Fraction */
+	for(column=0; column<=eqCount; column++)
+	{
+		coefficient[(row-1)][column] = multiply(coefficient[(row-1)][column], multiplier);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to divide a row in the altered
+	matrix by the specified fraction value. Note this is an overloaded
+	version of the private method divideMatrixRow().
+
+	Parameters: 
+		row - matrix row to be divided
+		divisor - fraction value by which to divide
+
+	Returns:
+		Returns nothing. If row is out of bounds the function returns 
+		without altering any memory. 
+*/
+void eqsolver::divideMatrixRow(unsigned short int row, struct fraction divisor)
+{
+	unsigned int column;
+	
+	/* Perform Bounds Checking */
+	if((row < 1) || (row > eqCount))
+		return;	/* Out Of Bounds, Return */
+
+	if(!expandStorage() || !prepareAltered())
+		return;	/* Altered Matrix Needs Regular Storage */
+
+	/* Divide Each Value In Specified Row By "divisor" Fraction */
+	for(column=0; column<=eqCount; column++)
+	{
+		coefficient[(row-1)][column] = divide(coefficient[(row-1)][column], divisor);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to add a row to another row
+	in the altered matrix. Note this is an overloaded version of 
+	the private method addMatrixRows().
+
+	Parameters: 
+		row - matrix row to be added to
+		rowToAdd - matrix row to add
+
+	Returns:
+		Returns nothing. If row is out of bounds the function returns 
+		without altering any memory. 
+*/
+void eqsolver::addMatrixRows(unsigned short int row, unsigned short int rowToAdd)
+{
+	unsigned int column;
+	
+	/* Perform Bounds Checking */
+	if((row < 1) || (row > eqCount) || (rowToAdd < 1) || (rowToAdd > eqCount))
+		return;	/* Out Of Bounds, Return */
+
+	if(!expandStorage() || !prepareAltered())
+		return;	/* Altered Matrix Needs Regular Storage */
+
+	/* Add Each Value In Specified rowToAdd To row */
+	for(column=0; column<=eqCount; column++)
+	{
+		coefficient[(row-1)][column] = add(coefficient[(row-1)][column], coefficient[(rowToAdd-1)][column]);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to solve the system specified
+	in the "original" matrix coefficients.
+
+	Parameters: 
+		None
+
+	Returns:
+		Returns SOLVED, NO_SOLUTIONS, or INFINITE_SOLUTIONS.
+		If SOLVED, the solution coefficients can be located by
+		member variable solutionCoefficient. If INFINITE_SOLUTIONS,
+		solutionCoefficient holds one particular solution, pivotColumn
+		the pivotCount pivot columns and nullspaceBasis the nullity
+		vectors spanning the solutions of the homogeneous system.
+		MEMORY_ERROR is returned on allocation errors. Returns
+		OVERFLOW on 32-bit Overflow. Once addEquation() has returned
+		NO_SOLUTIONS or OVERFLOW, that status is returned again.
+*/
+unsigned int eqsolver::solveSystem(void)
+{
+	unsigned int status;
+	struct fraction **coeffPtr;
+	int resume;
+	
+	overFlow = 0;	/* Reset Overflow Flag */
+	resume = checkpointResume;	/* Set By resumeSystem() */
+	checkpointResume = 0;
+	releaseParametricSolution();	/* Discard Results Of Previous Solve */
+
+	/* addEquation() Failed: Later Equations Were Never Received */
+	if(streamStatus != 0)
+		return streamStatus;
+
+	/* Band, Symmetric & Structured Storage: Regular Storage Only Needed If Singular Or On Overflow */
+	if((bandCoefficient != NULL) || (symmetricCoefficient != NULL) || (structureType != STRUCTURE_NONE))
+	{
+		if(bandCoefficient != NULL)
+			status = solveBandStorage();
+		else if(symmetricCoefficient != NULL)
+			status = solveSymmetricStorage();
+		else
+			status = solveStructureStorage();
+		if(status != 0)
+			return status;
+		if(!expandStorage())
+			return overFlow ? OVERFLOW : MEMORY_ERROR;
+	}
+	
+	/* Triangular & Diagonal Systems Need No Elimination */
+	status = triangularSolve();
+	if(status != 0)
+		return status;
+
+	/* Create "Working Copy" Of Matrix To Solve */
+
+	coeffPtr = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	
+	if(coeffPtr == NULL)
+		return MEMORY_ERROR;
+
+	/* Allocate Rows & Copy Matrix Coefficients From "original" Matrix
+		To Working Copy, Row Blocks On The NUMA Node Of Their Thread */
+	if(!placeOriginal(coeffPtr, arenaRegion(ARENA_WORKING)))
+	{
+		destroyMatrix(coeffPtr);
+		return MEMORY_ERROR;
+	}
+
+	/* Checkpointed Solves Run Gauss-Jordan Elimination Alone: Between
+		Pivots Its State Is Just The Working Copy & Pivot Position */
+	if(checkpointPath != NULL)
+	{
+		status = checkpointSolve(coeffPtr, resume);
+		destroyMatrix(coeffPtr);
+		return status;
+	}
+
+	/* Simplify First, Dense Elimination On Whatever Is Left. Out Of
+		Core, Stages Copying Subsystems To Memory Are Skipped & The
+		Tiles Are Always Eliminated Panel By Panel */
+	status = 0;
+	if(presolveEnabled && !arenaFileBacked)
+		status = presolveSystem(coeffPtr);
+	if((status == 0) && componentEnabled && !arenaFileBacked)
+		status = componentSolve(coeffPtr);
+	if((status == 0) && bandEnabled)
+		status = bandSolve(coeffPtr);
+	if((status == 0) && blockEnabled && !arenaFileBacked)
+		status = blockSolve(coeffPtr);
+	if((status == 0) && (tiledEnabled || arenaFileBacked))
+		status = tiledSolve(coeffPtr);
+	if(status == 0)
+		status = solveDense(coeffPtr, 0);
+
+	destroyMatrix(coeffPtr);
+
+	return status;
+}
+
+/*	The purpose of this function is to solve the system directly when
+	the "original" matrix is upper triangular, lower triangular or
+	diagonal. The structural scan stops at the first nonzero on both
+	sides of the diagonal, so other systems cost little. With a nonzero
+	diagonal, back / forward substitution (division alone if diagonal)
+	is exact, so the solution is not verified.
+
+	Parameters: 
+		None
+
+	Returns:
+		SOLVED, or 0 if the system is not triangular, has a zero on the
+		diagonal, or overflows (the regular path takes over).
+*/
+unsigned int eqsolver::triangularSolve(void)
+{
+	unsigned int i, j, k;
+	int upper, lower;	/* 1 = No Nonzero Below / Above The Diagonal Yet */
+	struct fraction sum;
+
+	upper = lower = 1;
+	for(i=0; (i<eqCount) && (upper || lower); i++)
+	{
+		if(originalValue(i, i).numerator == 0)
+			return 0;	/* Singular, Let The Regular Path Classify It */
+
+		for(j=0; (j<i) && upper; j++)
+			if(originalValue(i, j).numerator != 0)
+				upper = 0;
+		for(j=i+1; (j<eqCount) && lower; j++)
+			if(originalValue(i, j).numerator != 0)
+				lower = 0;
+	}
+
+	if(!upper && !lower)
+		return 0;
+
+	for(k=0; k<eqCount; k++)
+	{
+		/* Back Substitution Runs Bottom Up, Forward Substitution Top Down */
+		i = lower ? k : (eqCount-1-k);
+
+		sum = originalValue(i, eqCount);
+		if(!(upper && lower))
+		{
+			for(j=(lower ? 0 : (i+1)); j<(lower ? i : eqCount); j++)
+				if(originalValue(i, j).numerator != 0)
+					sum = subtract(sum, multiply(originalValue(i, j), solutionCoefficient[j]));
+		}
+		solutionCoefficient[i] = divide(sum, originalValue(i, i));
+
+		if(overFlow)
+		{
+			overFlow = 0;
+			return 0;
+		}
+	}
+
+	/* Every Column Is A Pivot Column */
+	for(i=0; i<eqCount; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = eqCount;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to simplify the working copy of
+	the system before the dense elimination runs (presolve). In order:
+	- the content (GCD of the numerators) is divided out of every
+	integer row, and each row is scaled so its first coefficient is
+	positive, which keeps values small and makes duplicates identical
+	- all-zero rows and exact duplicate rows are dropped (a zero row
+	reading 0 = nonzero, or two equal rows with different RHS, is
+	reported as NO_SOLUTIONS on the spot)
+	- rows with a single nonzero coefficient fix their unknown, which is
+	substituted into the other rows (row singletons)
+	- unknowns appearing in a single row are set aside with that row and
+	back-substituted once the rest is solved (column singletons)
+	What remains (the core) is solved by a nested eqsolver, padded with
+	zero rows if rows were dropped, and the results merged back.
+
+	Parameters: 
+		coeffPtr - working copy to operate on (altered)
+
+	Returns:
+		0 if no unknown could be eliminated; coeffPtr is then an
+		equivalent (scaled, duplicates zeroed) system for solveDense().
+		Otherwise the same as solveSystem().
+*/
+unsigned int eqsolver::presolveSystem(struct fraction **coeffPtr)
+{
+	struct presolveWork work;
+	unsigned int status;
+
+	work.rowCount = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.columnCount = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.columnRow = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.order = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.columnMap = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.rowState = (unsigned char *) allocateMemory(eqCount * sizeof(unsigned char));
+	work.columnState = (unsigned char *) allocateMemory(eqCount * sizeof(unsigned char));
+	work.keys = (struct presolveKey *) allocateMemory(eqCount * sizeof(struct presolveKey));
+
+	if((work.rowCount == NULL) || (work.columnCount == NULL) || (work.columnRow == NULL) ||
+		(work.order == NULL) || (work.columnMap == NULL) || (work.rowState == NULL) ||
+		(work.columnState == NULL) || (work.keys == NULL))
+		status = MEMORY_ERROR;
+	else
+	{
+		status = presolveReduce(coeffPtr, work);
+		if(status == SOLVED)	/* Unknowns Eliminated, Solve What Remains */
+			status = presolveCore(coeffPtr, work);
+	}
+
+	if(work.rowCount != NULL) releaseMemory(work.rowCount);
+	if(work.columnCount != NULL) releaseMemory(work.columnCount);
+	if(work.columnRow != NULL) releaseMemory(work.columnRow);
+	if(work.order != NULL) releaseMemory(work.order);
+	if(work.columnMap != NULL) releaseMemory(work.columnMap);
+	if(work.rowState != NULL) releaseMemory(work.rowState);
+	if(work.columnState != NULL) releaseMemory(work.columnState);
+	if(work.keys != NULL) releaseMemory(work.keys);
+
+	return status;
+}
+
+/*	The purpose of this function is to perform the reductions of
+	presolveSystem() on the working copy. Values of unknowns fixed by
+	row singletons are stored in solutionCoefficient.
+
+	Parameters: 
+		coeffPtr - working copy to operate on (altered)
+		work - presolve workspace (filled in)
+
+	Returns:
+		SOLVED if unknowns were eliminated (the core remains to be
+		solved), 0 if none were, NO_SOLUTIONS if an inconsistency was
+		found, OVERFLOW on 32-bit Overflow.
+*/
+unsigned int eqsolver::presolveReduce(struct fraction **coeffPtr, struct presolveWork &work)
+{
+	unsigned int i, j, k, column, activeRows, changed, eliminated;
+	struct fraction value;
+
+	/* Row Content, Sign & Counts */
+	for(j=0; j<eqCount; j++)
+	{
+		work.columnCount[j] = 0;
+		work.columnState[j] = PRESOLVE_ACTIVE;
+	}
+	for(i=0; i<eqCount; i++)
+	{
+		normalizeRow(coeffPtr[i]);
+
+		work.rowCount[i] = 0;
+		work.rowState[i] = PRESOLVE_ACTIVE;
+		for(j=0; j<eqCount; j++)
+		{
+			if(coeffPtr[i][j].numerator != 0)
+			{
+				work.rowCount[i]++;
+				work.columnCount[j]++;
+			}
+		}
+	}
+
+	/* Zero Rows: 0 = 0 Is Dropped, 0 = Nonzero Has No Solutions */
+	for(i=0; i<eqCount; i++)
+	{
+		if(work.rowCount[i] != 0)
+			continue;
+		if(coeffPtr[i][eqCount].numerator != 0)
+			return NO_SOLUTIONS;
+		work.rowState[i] = PRESOLVE_DROPPED;
+	}
+
+	/* Duplicate Rows: Sort By Hash, Compare Rows With Equal Hashes */
+	activeRows = 0;
+	for(i=0; i<eqCount; i++)
+	{
+		if(work.rowState[i] != PRESOLVE_ACTIVE)
+			continue;
+		work.keys[activeRows].row = i;
+		work.keys[activeRows].hash = 0;
+		for(j=0; j<eqCount; j++)
+		{
+			if(coeffPtr[i][j].numerator == 0)
+				continue;
+			work.keys[activeRows].hash = (work.keys[activeRows].hash * 31) + j;
+			work.keys[activeRows].hash = (work.keys[activeRows].hash * 31) + coeffPtr[i][j].numerator;
+			work.keys[activeRows].hash = (work.keys[activeRows].hash * 31) + coeffPtr[i][j].denominator + coeffPtr[i][j].sign;
+		}
+		activeRows++;
+	}
+	qsort(work.keys, activeRows, sizeof(struct presolveKey), comparePresolveKeys);
+
+	for(i=1; i<activeRows; i++)
+	{
+		for(k=i; (k>0) && (work.keys[(k-1)].hash == work.keys[i].hash); k--)
+		{
+			if(work.rowState[work.keys[(k-1)].row] != PRESOLVE_ACTIVE)
+				continue;
+			if(!sameCoefficients(coeffPtr[work.keys[i].row], coeffPtr[work.keys[(k-1)].row], eqCount))
+				continue;
+
+			/* Same Left Side, Right Sides Must Agree */
+			if(!sameCoefficients(&coeffPtr[work.keys[i].row][eqCount], &coeffPtr[work.keys[(k-1)].row][eqCount], 1))
+				return NO_SOLUTIONS;
+
+			/* Drop Duplicate, Leaving A Zero Row */
+			for(j=0; j<=eqCount; j++)
+			{
+				if((j < eqCount) && (coeffPtr[work.keys[i].row][j].numerator != 0))
+					work.columnCount[j]--;
+				coeffPtr[work.keys[i].row][j].numerator = coeffPtr[work.keys[i].row][j].denominator = 0;
+				coeffPtr[work.keys[i].row][j].sign = 0;
+			}
+			work.rowState[work.keys[i].row] = PRESOLVE_DROPPED;
+			break;
+		}
+	}
+
+	/* Singletons, Until Nothing Changes */
+	eliminated = 0;
+	work.orderCount = 0;
+	do
+	{
+		changed = 0;
+
+		/* Row Singletons Fix Their Unknown */
+		for(i=0; i<eqCount; i++)
+		{
+			if((work.rowState[i] != PRESOLVE_ACTIVE) || (work.rowCount[i] != 1))
+				continue;
+
+			for(column=0; coeffPtr[i][column].numerator == 0; column++)
+				;
+
+			solutionCoefficient[column] = divide(coeffPtr[i][eqCount], coeffPtr[i][column]);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+
+			work.columnState[column] = PRESOLVE_FIXED;
+			work.rowState[i] = PRESOLVE_FIXED;
+			work.columnCount[column] = 0;
+			eliminated++;
+			changed = 1;
+
+			/* Substitute Into Remaining Rows */
+			for(k=0; k<eqCount; k++)
+			{
+				if((work.rowState[k] != PRESOLVE_ACTIVE) || (coeffPtr[k][column].numerator == 0))
+					continue;
+
+				value = multiply(coeffPtr[k][column], solutionCoefficient[column]);
+				coeffPtr[k][eqCount] = subtract(coeffPtr[k][eqCount], value);
+				if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+
+				coeffPtr[k][column].numerator = coeffPtr[k][column].denominator = 0;
+				coeffPtr[k][column].sign = 0;
+				work.rowCount[k]--;
+
+				if(work.rowCount[k] == 0)	/* Became A Zero Row */
+				{
+					if(coeffPtr[k][eqCount].numerator != 0)
+						return NO_SOLUTIONS;
+					work.rowState[k] = PRESOLVE_DROPPED;
+				}
+			}
+		}
+
+		/* Column Singletons Are Set Aside With Their Row */
+		for(column=0; column<eqCount; column++)
+		{
+			if((work.columnState[column] != PRESOLVE_ACTIVE) || (work.columnCount[column] != 1))
+				continue;
+
+			for(i=0; (work.rowState[i] != PRESOLVE_ACTIVE) || (coeffPtr[i][column].numerator == 0); i++)
+				;
+
+			work.columnState[column] = PRESOLVE_SUBSTITUTED;
+			work.columnRow[column] = i;
+			work.order[work.orderCount++] = column;
+			work.rowState[i] = PRESOLVE_SUBSTITUTED;
+			for(j=0; j<eqCount; j++)
+				if(coeffPtr[i][j].numerator != 0)
+					work.columnCount[j]--;
+			eliminated++;
+			changed = 1;
+		}
+	} while(changed);
+
+	return (eliminated > 0) ? SOLVED : 0;
+}
+
+/*	The purpose of this function is to solve the core left by
+	presolveReduce() with a nested eqsolver and back-substitute the
+	column singletons.
+
+	Parameters: 
+		coeffPtr - reduced working copy
+		work - presolve workspace filled in by presolveReduce()
+
+	Returns:
+		Same as solveSystem().
+*/
+unsigned int eqsolver::presolveCore(struct fraction **coeffPtr, struct presolveWork &work)
+{
+	unsigned int i, j, k, column, coreCount, status;
+	eqsolver core;
+
+	/* Core: Remaining Unknowns, Remaining Rows Padded With Zero Rows */
+	coreCount = 0;
+	for(column=0; column<eqCount; column++)
+		if(work.columnState[column] == PRESOLVE_ACTIVE)
+			work.columnMap[coreCount++] = column;
+
+	status = SOLVED;
+
+	if(coreCount > 0)
+	{
+		core.hugePagesEnabled = hugePagesEnabled;
+		core.compactEnabled = 0;	/* Filled With Fractions Below */
+		core.parentAccount = activeAccount();
+		if(!core.setSystemEqCount((unsigned short int) coreCount))
+		{
+			core.cleanup();
+			return MEMORY_ERROR;
+		}
+
+		k = 0;	/* Core Row */
+		for(i=0; i<eqCount; i++)
+		{
+			if(work.rowState[i] != PRESOLVE_ACTIVE)
+				continue;
+			for(j=0; j<coreCount; j++)
+				core.originalCoefficient[k][j] = coeffPtr[i][work.columnMap[j]];
+			core.originalCoefficient[k][coreCount] = coeffPtr[i][eqCount];
+			k++;
+		}
+
+		inheritSettings(core);
+		core.presolveEnabled = 0;
+		status = core.solveSystem();
+
+		if((status == SOLVED) || (status == INFINITE_SOLUTIONS))
+		{
+			for(j=0; j<coreCount; j++)
+				solutionCoefficient[work.columnMap[j]] = core.solutionCoefficient[j];
+
+			if((status == INFINITE_SOLUTIONS) && !importNullspace(core, work.columnMap))
+				status = MEMORY_ERROR;
+		}
+		else if(status == OVERFLOW)
+			overFlow = 1;
+
+		core.cleanup();
+
+		if((status != SOLVED) && (status != INFINITE_SOLUTIONS))
+		{
+			releaseParametricSolution();
+			return status;
+		}
+	}
+
+	/* Back-Substitute Column Singletons, Last Set Aside First */
+	for(k=work.orderCount; k>0; k--)
+	{
+		column = work.order[(k-1)];
+		backSubstitute(coeffPtr[work.columnRow[column]], column, solutionCoefficient, 1);
+		for(j=0; j<nullity; j++)
+			backSubstitute(coeffPtr[work.columnRow[column]], column, nullspaceBasis[j], 0);
+		if(overFlow)
+		{
+			releaseParametricSolution();
+			return OVERFLOW;
+		}
+	}
+
+	/* Free Columns As Without Presolve: The Core's Depend On Which
+		Unknowns Were Set Aside */
+	if((status == INFINITE_SOLUTIONS) && !reduceNullspace())
+	{
+		releaseParametricSolution();
+		return OVERFLOW;
+	}
+
+	status = verifySolution(solutionCoefficient, status);
+	if((status != SOLVED) && (status != INFINITE_SOLUTIONS))
+	{
+		releaseParametricSolution();
+		return status;
+	}
+
+	/* Every Column Is A Pivot Column */
+	if(status == SOLVED)
+	{
+		for(column=0; column<eqCount; column++)
+			pivotColumn[column] = (unsigned short int)(column+1);
+		pivotCount = eqCount;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to divide the content (GCD of
+	the numerators) out of an integer row and make its first nonzero
+	coefficient positive. Rows holding fractions are only sign
+	normalized. Dividing the RHS can turn it into a fraction; if its
+	denominator would overflow the content is left in.
+
+	Parameters: 
+		rowPtr - row of eqCount+1 fractions (altered)
+
+	Returns:
+		None
+*/
+void eqsolver::normalizeRow(struct fraction *rowPtr)
+{
+	unsigned int column, content, first;
+	UINT64 denominator;
+
+	content = 0;
+	for(column=0; column<eqCount; column++)
+	{
+		if(rowPtr[column].numerator == 0)
+			continue;
+		if(rowPtr[column].denominator != 1)
+		{
+			content = 1;	/* Fraction, Leave Scale Alone */
+			break;
+		}
+		content = (unsigned int) gcd64((UINT64)content, (UINT64)rowPtr[column].numerator);
+	}
+
+	if(content > 1)
+	{
+		denominator = (UINT64)rowPtr[eqCount].denominator * (UINT64)content;
+		if((rowPtr[eqCount].numerator == 0) || (denominator <= UINT32MAX))
+		{
+			for(column=0; column<eqCount; column++)
+				rowPtr[column].numerator = rowPtr[column].numerator / content;
+			if(rowPtr[eqCount].numerator != 0)
+			{
+				rowPtr[eqCount].denominator = (unsigned int) denominator;
+				rowPtr[eqCount] = reduce(rowPtr[eqCount]);
+			}
+		}
+	}
+
+	/* First Coefficient Positive */
+	for(first=0; (first<eqCount) && (rowPtr[first].numerator == 0); first++)
+		;
+	if((first < eqCount) && (rowPtr[first].sign == 1))
+		for(column=0; column<=eqCount; column++)
+			if(rowPtr[column].numerator != 0)
+				rowPtr[column].sign = (rowPtr[column].sign == 1) ? 0 : 1;
+}
+
+/*	The purpose of this function is to compare two runs of fractions
+	for equality. Values are compared in reduced form.
+
+	Parameters: 
+		values1, values2 - fractions to compare
+		count - number of fractions
+
+	Returns:
+		1 if equal
+		0 otherwise
+*/
+int eqsolver::sameCoefficients(struct fraction *values1, struct fraction *values2, unsigned int count)
+{
+	unsigned int i;
+	struct fraction value1, value2;
+
+	for(i=0; i<count; i++)
+	{
+		value1 = reduce(values1[i]);
+		value2 = reduce(values2[i]);
+		if((value1.numerator != value2.numerator) ||
+			(value1.denominator != value2.denominator) ||
+			(value1.sign != value2.sign))
+			return 0;
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to order presolve hash keys for
+	qsort().
+
+	Parameters: 
+		key1, key2 - pointers to the presolveKey structures to compare
+
+	Returns:
+		-1, 0 or 1 as key1's hash is below, equal to or above key2's.
+*/
+int eqsolver::comparePresolveKeys(const void *key1, const void *key2)
+{
+	const struct presolveKey *first = (const struct presolveKey *) key1;
+	const struct presolveKey *second = (const struct presolveKey *) key2;
+
+	if(first->hash < second->hash)
+		return -1;
+	if(first->hash > second->hash)
+		return 1;
+
+	return (first->row < second->row) ? -1 : ((first->row > second->row) ? 1 : 0);
+}
+
+/*	The purpose of this function is to solve one equation for one
+	unknown, every other unknown being known.
+
+	Parameters: 
+		rowPtr - equation (eqCount+1 fractions)
+		column - unknown to solve for (starting at 0)
+		values - eqCount unknowns; values[column] receives the result
+		useRHS - 0 to solve the homogeneous equation (RHS taken as 0)
+
+	Returns:
+		None. Check overFlow after calling.
+*/
+void eqsolver::backSubstitute(struct fraction *rowPtr, unsigned int column, struct fraction *values, int useRHS)
+{
+	unsigned int j;
+	struct fraction total;
+
+	if(useRHS)
+		total = rowPtr[eqCount];
+	else
+	{
+		total.numerator = total.denominator = 0;
+		total.sign = 0;
+	}
+
+	for(j=0; (j<eqCount) && !overFlow; j++)
+	{
+		if((j == column) || (rowPtr[j].numerator == 0) || (values[j].numerator == 0))
+			continue;
+		total = subtract(total, multiply(rowPtr[j], values[j]));
+	}
+
+	values[column] = divide(total, rowPtr[column]);
+}
+
+/*	The purpose of this function is to pass the settings switching
+	solveSystem() stages on or off to a nested eqsolver (presolve core,
+	component or block subsystem), so they hold for the whole solve.
+	The caller then switches off the stages already applied.
+
+	Parameters: 
+		sub - nested eqsolver, before it is solved
+
+	Returns:
+		None
+*/
+void eqsolver::inheritSettings(eqsolver &sub)
+{
+	sub.bandEnabled = bandEnabled;
+	sub.componentEnabled = componentEnabled;
+	sub.blockEnabled = blockEnabled;
+	sub.tiledEnabled = tiledEnabled;
+	sub.tileSize = tileSize;
+	sub.threadCount = threadCount;
+}
+
+/*	The purpose of this function is to append the nullspace basis
+	found by a nested eqsolver for a subset of the unknowns to this
+	system's basis.
+
+	Parameters: 
+		sub - nested eqsolver which returned INFINITE_SOLUTIONS
+		columnMap - this system's column for each of sub's columns
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+int eqsolver::importNullspace(eqsolver &sub, const unsigned int *columnMap)
+{
+	unsigned int i, j;
+	struct fraction **basis;
+
+	basis = (struct fraction **) reallocateMemory(nullspaceBasis, (nullity + sub.nullity) * sizeof(struct fraction *));
+	if(basis == NULL)
+		return 0;
+	nullspaceBasis = basis;
+
+	for(i=0; i<sub.nullity; i++)
+	{
+		nullspaceBasis[nullity] = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+		if(nullspaceBasis[nullity] == NULL)
+			return 0;
+
+		for(j=0; j<eqCount; j++)
+		{
+			nullspaceBasis[nullity][j].numerator = nullspaceBasis[nullity][j].denominator = 0;
+			nullspaceBasis[nullity][j].sign = 0;
+		}
+		for(j=0; j<sub.eqCount; j++)
+			nullspaceBasis[nullity][columnMap[j]] = sub.nullspaceBasis[i][j];
+
+		nullity++;
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to bring the solutions merged
+	from nested eqsolvers to the form finishReducedEchelon() gives:
+	leftmost pivot columns, free unknowns 0 in the particular solution
+	and nullspace vector k 1 in the k-th free column, 0 in the others.
+	Column j is free when the columns left of it span it, that is when
+	some nullspace vector ends in column j, so the basis is reduced
+	from the right.
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success
+		0 on 32-bit Overflow
+*/
+int eqsolver::reduceNullspace(void)
+{
+	unsigned int i, k, column, found, pivot;
+	struct fraction *temp;
+	struct fraction multiplier;
+
+	found = 0;	/* Vectors Reduced, One Per Free Column */
+	pivot = eqCount - nullity;	/* Pivot Columns Are Listed From The Right */
+	for(column=eqCount; column>0; column--)
+	{
+		for(k=found; k<nullity; k++)
+			if(nullspaceBasis[k][(column-1)].numerator != 0)
+				break;
+
+		if(k == nullity)	/* Pivot Column */
+		{
+			pivotColumn[--pivot] = (unsigned short int) column;
+			continue;
+		}
+
+		temp = nullspaceBasis[k];
+		nullspaceBasis[k] = nullspaceBasis[found];
+		nullspaceBasis[found] = temp;
+
+		/* Free Unknown = 1 */
+		multiplier = nullspaceBasis[found][(column-1)];
+		for(i=0; i<eqCount; i++)
+		{
+			if(nullspaceBasis[found][i].numerator != 0)
+				nullspaceBasis[found][i] = divide(nullspaceBasis[found][i], multiplier);
+			if(overFlow) return 0;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		/* Other Vectors & The Particular Solution Are 0 In This Column */
+		for(k=0; k<nullity; k++)
+		{
+			if((k == found) || (nullspaceBasis[k][(column-1)].numerator == 0))
+				continue;
+			subtractScaledRow(nullspaceBasis[k], nullspaceBasis[found], nullspaceBasis[k][(column-1)], 0, eqCount);
+			if(overFlow) return 0;	/* Overflow Occurred, No Reason To Continue */
+		}
+		if(solutionCoefficient[(column-1)].numerator != 0)
+		{
+			subtractScaledRow(solutionCoefficient, nullspaceBasis[found], solutionCoefficient[(column-1)], 0, eqCount);
+			if(overFlow) return 0;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		found++;
+	}
+	pivotCount = (unsigned short int)(eqCount - nullity);
+
+	/* Basis In Order Of Free Column, Leftmost First */
+	for(k=0; k<(nullity/2); k++)
+	{
+		temp = nullspaceBasis[k];
+		nullspaceBasis[k] = nullspaceBasis[(nullity-1-k)];
+		nullspaceBasis[(nullity-1-k)] = temp;
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to solve the working copy by
+	splitting it into independent subsystems: the connected components
+	of the graph linking each equation to the unknowns it holds. Each
+	component is solved by its own eqsolver, concurrently, and the
+	results are merged. Systems forming a single component, or with a
+	component holding more equations than unknowns, are left to the
+	later stages.
+
+	Parameters: 
+		coeffPtr - working copy (not altered)
+
+	Returns:
+		0 if the system was not solved here. Otherwise the same as
+		solveSystem().
+*/
+unsigned int eqsolver::componentSolve(struct fraction **coeffPtr)
+{
+	struct componentWork work;
+	unsigned int i, status;
+
+	if(eqCount < 2)
+		return 0;
+
+	work.count = eqCount;
+	work.coeffPtr = coeffPtr;
+	work.solution = solutionCoefficient;
+	work.componentCount = 0;
+	work.solver = NULL;
+	work.parent = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.columnComponent = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.rowComponent = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.componentStart = (unsigned int *) allocateMemory((eqCount+1) * sizeof(unsigned int));
+	work.componentColumn = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.rowStart = (unsigned int *) allocateMemory((eqCount+1) * sizeof(unsigned int));
+	work.componentRow = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.componentStatus = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+
+	if((work.parent == NULL) || (work.columnComponent == NULL) || (work.rowComponent == NULL) ||
+		(work.componentStart == NULL) || (work.componentColumn == NULL) || (work.rowStart == NULL) || (work.componentRow == NULL) ||
+		(work.componentStatus == NULL))
+		status = MEMORY_ERROR;
+	else
+		status = solveComponents(work);
+
+	if((status != 0) && (status != SOLVED) && (status != INFINITE_SOLUTIONS))
+		releaseParametricSolution();
+
+	if(work.solver != NULL)
+	{
+		for(i=0; i<work.componentCount; i++)
+			work.solver[i].cleanup();
+		releaseMemory(work.solver);
+	}
+
+	if(work.parent != NULL) releaseMemory(work.parent);
+	if(work.columnComponent != NULL) releaseMemory(work.columnComponent);
+	if(work.rowComponent != NULL) releaseMemory(work.rowComponent);
+	if(work.componentStart != NULL) releaseMemory(work.componentStart);
+	if(work.componentColumn != NULL) releaseMemory(work.componentColumn);
+	if(work.rowStart != NULL) releaseMemory(work.rowStart);
+	if(work.componentRow != NULL) releaseMemory(work.componentRow);
+	if(work.componentStatus != NULL) releaseMemory(work.componentStatus);
+
+	return status;
+}
+
+/*	The purpose of this function is to carry out componentSolve() once
+	its workspace is allocated.
+
+	Parameters: 
+		work - component workspace
+
+	Returns:
+		Same as componentSolve().
+*/
+unsigned int eqsolver::solveComponents(struct componentWork &work)
+{
+	unsigned int i, j, root, other, component, solverCount, parallelCount, status;
+	int parallel;	/* 1 When Components Run Under runParallel() */
+	struct fraction **coeffPtr = work.coeffPtr;
+	struct fraction **basis;
+	eqsolver fresh;
+
+	/* Union-Find: Unknowns Sharing An Equation Share A Component */
+	for(j=0; j<eqCount; j++)
+		work.parent[j] = j;
+
+	for(i=0; i<eqCount; i++)
+	{
+		root = eqCount;
+		for(j=0; j<eqCount; j++)
+		{
+			if(coeffPtr[i][j].numerator == 0)
+				continue;
+			other = j;
+			while(work.parent[other] != other)
+				other = work.parent[other] = work.parent[work.parent[other]];
+			if(root == eqCount)
+				root = other;
+			else if(other != root)
+			{
+				if(other < root)
+				{
+					work.parent[root] = other;
+					root = other;
+				}
+				else
+					work.parent[other] = root;
+			}
+		}
+
+		/* Equation Without Unknowns: 0 = RHS */
+		if((root == eqCount) && (coeffPtr[i][eqCount].numerator != 0))
+			return NO_SOLUTIONS;
+	}
+
+	/* Number The Components, Every Parent Precedes Its Child */
+	work.componentCount = 0;
+	for(j=0; j<eqCount; j++)
+	{
+		if(work.parent[j] == j)
+			work.columnComponent[j] = work.componentCount++;
+		else
+			work.columnComponent[j] = work.columnComponent[work.parent[j]];
+	}
+
+	if(work.componentCount < 2)
+		return 0;
+
+	/* Component Of Each Row, eqCount For Rows Without Unknowns */
+	for(i=0; i<eqCount; i++)
+	{
+		work.rowComponent[i] = eqCount;
+		for(j=0; j<eqCount; j++)
+			if(coeffPtr[i][j].numerator != 0)
+			{
+				work.rowComponent[i] = work.columnComponent[j];
+				break;
+			}
+	}
+
+	/* Group Columns & Rows By Component */
+	for(component=0; component<=work.componentCount; component++)
+		work.componentStart[component] = work.rowStart[component] = 0;
+	for(j=0; j<eqCount; j++)
+		work.componentStart[(work.columnComponent[j]+1)]++;
+	for(i=0; i<eqCount; i++)
+		if(work.rowComponent[i] != eqCount)
+			work.rowStart[(work.rowComponent[i]+1)]++;
+
+	solverCount = parallelCount = 0;
+	for(component=0; component<work.componentCount; component++)
+	{
+		/* More Equations Than Unknowns, Can Not Be Solved Alone */
+		if(work.rowStart[(component+1)] > work.componentStart[(component+1)])
+			return 0;
+		if(work.rowStart[(component+1)] > 0)
+			solverCount++;
+		if(work.componentStart[(component+1)] > 1)
+			parallelCount++;
+		work.componentStart[(component+1)] += work.componentStart[component];
+		work.rowStart[(component+1)] += work.rowStart[component];
+	}
+	if(solverCount < 2)
+		return 0;	/* One Component Plus Free Unknowns, Nothing To Gain */
+
+	for(j=0; j<eqCount; j++)
+		work.componentColumn[work.componentStart[work.columnComponent[j]]++] = j;
+	for(i=0; i<eqCount; i++)
+		if(work.rowComponent[i] != eqCount)
+			work.componentRow[work.rowStart[work.rowComponent[i]]++] = i;
+	for(component=work.componentCount; component>0; component--)
+	{
+		work.componentStart[component] = work.componentStart[(component-1)];
+		work.rowStart[component] = work.rowStart[(component-1)];
+	}
+	work.componentStart[0] = work.rowStart[0] = 0;
+
+	work.solver = (eqsolver *) allocateMemory(work.componentCount * sizeof(eqsolver));
+	if(work.solver == NULL)
+	{
+		work.componentCount = 0;	/* Nothing For componentSolve() To Clean Up */
+		return MEMORY_ERROR;
+	}
+	inheritSettings(fresh);
+	fresh.parentAccount = activeAccount();	/* Subsystems Charge This Solver */
+	fresh.compactEnabled = 0;	/* Filled With Fractions */
+	parallel = (parallelCount > 1) && (threadCount != 1);
+	if(parallel)
+		fresh.threadCount = 1;	/* Components Run In Parallel, Set Before Their Rows Are Placed */
+	for(component=0; component<work.componentCount; component++)
+		work.solver[component] = fresh;
+
+	/* Solve Components, Concurrently When Worthwhile */
+	if(parallel)
+		runParallel(activeAccount(), threadCount, work.componentCount, solveComponentTask, &work);
+	else
+		for(component=0; component<work.componentCount; component++)
+			solveComponentTask(&work, component);
+
+	/* Combined Status: Any Inconsistent Component Makes The System Inconsistent */
+	status = SOLVED;
+	for(component=0; component<work.componentCount; component++)
+	{
+		if(work.componentStatus[component] == NO_SOLUTIONS)
+			return NO_SOLUTIONS;
+		if((work.componentStatus[component] == MEMORY_ERROR) ||
+			((work.componentStatus[component] == OVERFLOW) && (status != MEMORY_ERROR)) ||
+			((work.componentStatus[component] == INFINITE_SOLUTIONS) && (status == SOLVED)))
+			status = work.componentStatus[component];
+	}
+	if(status == OVERFLOW)
+		overFlow = 1;
+	if((status != SOLVED) && (status != INFINITE_SOLUTIONS))
+		return status;
+
+	/* Merge Nullspace Bases, Unknowns Without Equations Are Free */
+	for(component=0; component<work.componentCount; component++)
+	{
+		if(work.componentStatus[component] != INFINITE_SOLUTIONS)
+			continue;
+
+		if(work.rowStart[component] == work.rowStart[(component+1)])
+		{
+			j = work.componentColumn[work.componentStart[component]];
+			basis = (struct fraction **) reallocateMemory(nullspaceBasis, (nullity+1) * sizeof(struct fraction *));
+			if(basis == NULL)
+				return MEMORY_ERROR;
+			nullspaceBasis = basis;
+			nullspaceBasis[nullity] = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+			if(nullspaceBasis[nullity] == NULL)
+				return MEMORY_ERROR;
+			for(i=0; i<eqCount; i++)
+			{
+				nullspaceBasis[nullity][i].numerator = nullspaceBasis[nullity][i].denominator = 0;
+				nullspaceBasis[nullity][i].sign = 0;
+			}
+			nullspaceBasis[nullity][j].numerator = nullspaceBasis[nullity][j].denominator = 1;
+			nullity++;
+			continue;
+		}
+
+		if(!importNullspace(work.solver[component], &work.componentColumn[work.componentStart[component]]))
+			return MEMORY_ERROR;
+	}
+
+	/* Basis Vectors Come Component By Component, Order Them By Free Column */
+	if((status == INFINITE_SOLUTIONS) && !reduceNullspace())
+		return OVERFLOW;
+
+	status = verifySolution(solutionCoefficient, status);
+	if((status != SOLVED) && (status != INFINITE_SOLUTIONS))
+		return status;
+
+	if(status == SOLVED)
+	{
+		for(j=0; j<eqCount; j++)
+			pivotColumn[j] = (unsigned short int)(j+1);
+		pivotCount = eqCount;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to solve one component with its
+	own eqsolver (kept in work.solver for its nullspace basis). It is
+	the task handed to runParallel(). A component without equations is
+	a single free unknown, set to 0.
+
+	Parameters: 
+		context - the componentWork
+		index - component #
+
+	Returns:
+		None. The component's unknowns are stored in work.solution and
+		work.componentStatus[index] is set as for solveSystem().
+*/
+void eqsolver::solveComponentTask(void *context, unsigned int index)
+{
+	struct componentWork *work = (struct componentWork *) context;
+	eqsolver *sub = &work->solver[index];
+	unsigned int i, j, first, size, firstRow, rowCount;
+
+	first = work->componentStart[index];
+	size = work->componentStart[(index+1)] - first;
+	firstRow = work->rowStart[index];
+	rowCount = work->rowStart[(index+1)] - firstRow;
+
+	if(rowCount == 0)
+	{
+		work->solution[work->componentColumn[first]].numerator = 0;
+		work->solution[work->componentColumn[first]].denominator = 0;
+		work->solution[work->componentColumn[first]].sign = 0;
+		work->componentStatus[index] = INFINITE_SOLUTIONS;
+		return;
+	}
+
+	if(!sub->setSystemEqCount((unsigned short int) size))
+	{
+		sub->cleanup();
+		work->componentStatus[index] = MEMORY_ERROR;
+		return;
+	}
+
+	/* Component Equations, Padded With Zero Rows */
+	for(i=0; i<rowCount; i++)
+	{
+		for(j=0; j<size; j++)
+			sub->originalCoefficient[i][j] = work->coeffPtr[work->componentRow[(firstRow+i)]][work->componentColumn[(first+j)]];
+		sub->originalCoefficient[i][size] = work->coeffPtr[work->componentRow[(firstRow+i)]][work->count];
+	}
+
+	sub->presolveEnabled = 0;
+	sub->componentEnabled = 0;
+	work->componentStatus[index] = sub->solveSystem();
+
+	if((work->componentStatus[index] == SOLVED) || (work->componentStatus[index] == INFINITE_SOLUTIONS))
+		for(j=0; j<size; j++)
+			work->solution[work->componentColumn[(first+j)]] = sub->solutionCoefficient[j];
+}
+
+/*	The purpose of this function is to allocate storage for a banded
+	system. Only the coefficients on the main diagonal, the "lower"
+	diagonals below it and the "upper" diagonals above it are kept
+	(plus the RHS), so memory is O(N*(lower+upper)) instead of O(N^2),
+	and solveSystem() runs a banded elimination in O(N*lower*(lower+upper)).
+	Setting a nonzero coefficient outside the band, or calling a
+	function which needs the full matrix (determinant(), factorSystem(),
+	addEquation(), ...), converts the system to regular storage.
+
+	Parameters: 
+		count - # of simultaneous equations (see setSystemEqCount())
+		lower - # of nonzero diagonals below the main diagonal
+		upper - # of nonzero diagonals above the main diagonal
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+unsigned int eqsolver::setSystemBand(unsigned short int count, unsigned short int lower, unsigned short int upper)
+{
+	unsigned int i, j, width;
+
+	/* No Need To Allocate Space, Empty System */
+	if(count == 0)
+		return 1;
+
+	if(lower >= count)
+		lower = count-1;
+	if(upper >= count)
+		upper = count-1;
+
+	eqCount = count;
+	streamRank = 0;	/* No Equations Absorbed Yet */
+	streamStatus = 0;
+	bandLower = lower;
+	bandUpper = upper;
+	width = lower + upper + 2;	/* Band & RHS */
+
+	bandCoefficient = (struct fraction **) allocateMemory(count * sizeof(struct fraction *));
+	solutionCoefficient = (struct fraction *) allocateMemory(count * sizeof(struct fraction));
+	pivotColumn = (unsigned short int *) allocateMemory(count * sizeof(unsigned short int));
+
+	if((bandCoefficient == NULL) || (solutionCoefficient == NULL) || (pivotColumn == NULL))
+		return 0;
+
+	for(i=0; i<count; i++)
+	{
+		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
+		solutionCoefficient[i].sign = 0;
+		bandCoefficient[i] = NULL;
+	}
+
+	/* Allocate & Zero Initialize Band Rows */
+	for(i=0; i<count; i++)
+	{
+		bandCoefficient[i] = (struct fraction *) allocateMemory(width * sizeof(struct fraction));
+		if(bandCoefficient[i] == NULL)
+			return 0;
+
+		for(j=0; j<width; j++)
+		{
+			bandCoefficient[i][j].numerator = bandCoefficient[i][j].denominator = 0;
+			bandCoefficient[i][j].sign = 0;
+		}
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to read a coefficient of a system
+	held in band storage.
+
+	Parameters: 
+		row - matrix row # (starting at 0)
+		column - matrix column # (starting at 0), eqCount for the RHS
+
+	Returns:
+		The coefficient (0 outside the band).
+*/
+struct fraction eqsolver::bandValue(unsigned int row, unsigned int column)
+{
+	struct fraction value;
+
+	if(column == eqCount)
+		return bandCoefficient[row][(bandLower+bandUpper+1)];
+
+	if(((column+bandLower) < row) || (column > (row+bandUpper)))
+	{
+		value.numerator = value.denominator = 0;
+		value.sign = 0;
+		return value;
+	}
+
+	return bandCoefficient[row][(column+bandLower-row)];
+}
+
+/*	The purpose of this function is to store a coefficient of a system
+	held in band, symmetric or structured storage. In symmetric storage
+	the coefficient mirrored across the diagonal is set as well.
+
+	Parameters: 
+		row - matrix row # (starting at 0)
+		column - matrix column # (starting at 0), eqCount for the RHS
+		value - coefficient
+
+	Returns:
+		1 if stored (a zero outside the band needs no storage), 0 if a
+		nonzero value lies outside the band or the system is held as
+		generators (only the RHS can be stored then).
+*/
+int eqsolver::storeValue(unsigned int row, unsigned int column, struct fraction value)
+{
+	if(structureType != STRUCTURE_NONE)
+	{
+		if(column != eqCount)
+			return 0;	/* Generators Can't Hold An Arbitrary Coefficient */
+		structureRHS[row] = value;
+	}
+	else if(symmetricCoefficient != NULL)
+	{
+		if(column == eqCount)
+			symmetricCoefficient[row][(eqCount-row)] = value;
+		else if(column < row)
+			symmetricCoefficient[column][(row-column)] = value;
+		else
+			symmetricCoefficient[row][(column-row)] = value;
+	}
+	else if(column == eqCount)
+		bandCoefficient[row][(bandLower+bandUpper+1)] = value;
+	else if(((column+bandLower) < row) || (column > (row+bandUpper)))
+		return (value.numerator == 0);
+	else
+		bandCoefficient[row][(column+bandLower-row)] = value;
+
+	return 1;
+}
+
+/*	The purpose of this function is to read a coefficient of the
+	"original" matrix, whichever storage holds it.
+
+	Parameters: 
+		row - matrix row # (starting at 0)
+		column - matrix column # (starting at 0), eqCount for the RHS
+
+	Returns:
+		The coefficient.
+*/
+struct fraction eqsolver::originalValue(unsigned int row, unsigned int column)
+{
+	if(structureType != STRUCTURE_NONE)
+		return structuredValue(row, column);
+
+	if(bandCoefficient != NULL)
+		return bandValue(row, column);
+
+	if(symmetricCoefficient != NULL)
+	{
+		if(column == eqCount)
+			return symmetricCoefficient[row][(eqCount-row)];
+		if(column < row)
+			return symmetricCoefficient[column][(row-column)];
+		return symmetricCoefficient[row][(column-row)];
+	}
+
+	if(compactNumerator != NULL)
+		return compactValue(row, column);
+
+	return originalCoefficient[row][column];
+}
+
+/*	The purpose of this function is to convert a system held in band,
+	symmetric or structured storage to regular storage
+	(originalCoefficient; coefficient follows on first use, see
+	prepareAltered()). Nothing is done for a system already in regular
+	storage.
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success, 0 on allocation errors or if a Vandermonde power
+		overflows (overFlow set; compact storage is kept).
+*/
+int eqsolver::expandStorage(void)
+{
+	struct fraction **denseOriginal;
+	unsigned int i, j;
+
+	if((bandCoefficient == NULL) && (symmetricCoefficient == NULL) && (structureType == STRUCTURE_NONE))
+		return 1;
+
+	denseOriginal = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	if(denseOriginal == NULL)
+		return 0;
+
+	for(i=0; i<eqCount; i++)
+		denseOriginal[i] = NULL;
+
+	for(i=0; i<eqCount; i++)
+	{
+		denseOriginal[i] = (struct fraction *) allocateMemory((eqCount+1) * sizeof(struct fraction));
+		if(denseOriginal[i] == NULL)
+		{
+			destroyMatrix(denseOriginal);
+			return 0;
+		}
+
+		for(j=0; j<=eqCount; j++)
+			denseOriginal[i][j] = originalValue(i, j);
+	}
+
+	if(overFlow)
+	{
+		destroyMatrix(denseOriginal);
+		return 0;
+	}
+
+	if(bandCoefficient != NULL)
+		destroyMatrix(bandCoefficient);
+	if(symmetricCoefficient != NULL)
+		destroyMatrix(symmetricCoefficient);
+	if(structureGenerator != NULL)
+		releaseMemory(structureGenerator);
+	if(structureRHS != NULL)
+		releaseMemory(structureRHS);
+	bandCoefficient = symmetricCoefficient = NULL;
+	structureGenerator = structureRHS = NULL;
+	structureType = STRUCTURE_NONE;
+	originalCoefficient = denseOriginal;
+
+	return 1;
+}
+
+/*	The purpose of this function is to read a coefficient of the
+	"original" matrix held in compact storage, as the fraction regular
+	storage would hold.
+
+	Parameters: 
+		row - matrix row # (starting at 0)
+		column - matrix column # (starting at 0), eqCount for the RHS
+
+	Returns:
+		The coefficient.
+*/
+struct fraction eqsolver::compactValue(unsigned int row, unsigned int column)
+{
+	return widenCompact(compactNumerator, compactDenominator, (UINT64) row * (eqCount+1) + column);
+}
+
+/*	The purpose of this function is to store a coefficient of the
+	"original" matrix in compact storage, as given. Denominators are
+	only stored once one is needed: until then every value is an
+	integer (0 standing for 0/0).
+
+	Parameters: 
+		row - matrix row # (starting at 0)
+		column - matrix column # (starting at 0), eqCount for the RHS
+		numerator - numerator as given
+		denominator - denominator as given (0 = 0/0)
+
+	Returns:
+		1 on success, 0 if storage for denominators could not be
+		allocated (nothing is stored then).
+*/
+int eqsolver::storeCompact(unsigned int row, unsigned int column, short int numerator, short int denominator)
+{
+	UINT64 index, i, count;
+
+	index = (UINT64) row * (eqCount+1) + column;
+
+	/* An Integer Or 0/0 Needs No Denominator */
+	if((compactDenominator == NULL) && !integerPair(numerator, denominator))
+	{
+		count = (UINT64) eqCount * (eqCount+1);
+		compactDenominator = (short int *) allocateMemory((size_t) count * sizeof(short int));
+		if(compactDenominator == NULL)
+			return 0;
+		for(i=0; i<count; i++)
+			compactDenominator[i] = (compactNumerator[i] == 0) ? 0 : 1;
+	}
+
+	compactNumerator[index] = numerator;
+	if(compactDenominator != NULL)
+		compactDenominator[index] = denominator;
+
+	return 1;
+}
+
+/*	The purpose of this function is to convert the "original" matrix
+	from compact storage to originalCoefficient, for the operations
+	changing it in place (absorbing equations, updates, growing or
+	shrinking the system). Nothing is done if it is not held in
+	compact storage.
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success, 0 on allocation errors (compact storage is kept).
+*/
+int eqsolver::widenOriginal(void)
+{
+	struct fraction **original;
+
+	if(compactNumerator == NULL)
+		return 1;
+
+	original = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	if(original == NULL)
+		return 0;
+
+	if(!placeOriginal(original, arenaRegion(ARENA_ORIGINAL)))
+	{
+		destroyMatrix(original);
+		return 0;
+	}
+
+	releaseMemory(compactNumerator);
+	if(compactDenominator != NULL)
+		releaseMemory(compactDenominator);
+	compactNumerator = compactDenominator = NULL;
+	originalCoefficient = original;
+
+	return 1;
+}
+
+/*	The purpose of this function is to copy the "original" matrix into
+	an allocated working copy again, whichever dense storage holds it.
+
+	Parameters: 
+		coeffPtr - working copy (overwritten)
+
+	Returns:
+		None
+*/
+void eqsolver::copyOriginal(struct fraction **coeffPtr)
+{
+	unsigned int i, j;
+
+	for(i=0; i<eqCount; i++)
+	{
+		if(originalCoefficient != NULL)
+			memcpy(coeffPtr[i], originalCoefficient[i], (eqCount+1) * sizeof(struct fraction));
+		else
+			for(j=0; j<=eqCount; j++)
+				coeffPtr[i][j] = compactValue(i, j);
+	}
+}
+
+/*	The purpose of this function is to set up the altered matrix on
+	first use, as a copy of the "original" matrix. Until the row
+	operations (swapRows() ..) or absorbing equations change it, it
+	reads the same as the original, so solves never hold it.
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success (or if already set up), 0 on allocation errors.
+*/
+int eqsolver::prepareAltered(void)
+{
+	struct fraction **altered;
+
+	if(coefficient != NULL)
+		return 1;
+
+	if((originalCoefficient == NULL) && (compactNumerator == NULL))
+		return 0;	/* System Not Dimensioned */
+
+	altered = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	if(altered == NULL)
+		return 0;
+
+	if(!placeOriginal(altered, NULL))
+	{
+		destroyMatrix(altered);
+		return 0;
+	}
+
+	coefficient = altered;
+
+	return 1;
+}
+
+/*	The purpose of this function is to allocate a zero-initialized
+	working copy for eliminateBand(). Row i holds columns i-lower ..
+	i+upper+lower (row swaps widen the upper band by lower), then the
+	RHS.
+
+	Parameters: 
+		lower, upper - bandwidths
+
+	Returns:
+		The rows, NULL on allocation errors.
+*/
+struct fraction **eqsolver::createBandWork(unsigned int lower, unsigned int upper)
+{
+	struct fraction **workPtr;
+	unsigned int i, j, width;
+
+	width = (2*lower) + upper + 2;
+
+	workPtr = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	if(workPtr == NULL)
+		return NULL;
+
+	for(i=0; i<eqCount; i++)
+		workPtr[i] = NULL;
+
+	for(i=0; i<eqCount; i++)
+	{
+		workPtr[i] = (struct fraction *) allocateMemory(width * sizeof(struct fraction));
+		if(workPtr[i] == NULL)
+		{
+			destroyMatrix(workPtr);
+			return NULL;
+		}
+
+		for(j=0; j<width; j++)
+		{
+			workPtr[i][j].numerator = workPtr[i][j].denominator = 0;
+			workPtr[i][j].sign = 0;
+		}
+	}
+
+	return workPtr;
+}
+
+/*	The purpose of this function is to solve a banded working copy
+	(see createBandWork()) by Gaussian elimination confined to the band,
+	taking the first nonzero pivot within the lower band, followed by
+	back substitution. The solution is stored in solutionCoefficient.
+
+	Parameters: 
+		workPtr - banded working copy (altered)
+		lower, upper - bandwidths
+
+	Returns:
+		SOLVED, 0 if a column has no nonzero pivot (singular system),
+		OVERFLOW on 32-bit Overflow.
+*/
+unsigned int eqsolver::eliminateBand(struct fraction **workPtr, unsigned int lower, unsigned int upper)
+{
+	unsigned int i, k, r, j, last, reach, rhs;
+	struct fraction multiplier, temp;
+
+	rhs = (2*lower) + upper + 1;
+
+	for(k=0; k<eqCount; k++)
+	{
+		last = ((k+lower) < eqCount) ? (k+lower) : (eqCount-1);
+		reach = ((k+lower+upper) < eqCount) ? (k+lower+upper) : (eqCount-1);
+
+		/* Pivot: First Nonzero In Column k Within The Band */
+		for(r=k; r<=last; r++)
+			if(workPtr[r][(k+lower-r)].numerator != 0)
+				break;
+		if(r > last)
+			return 0;
+
+		if(r != k)
+		{
+			for(j=k; j<=reach; j++)
+			{
+				temp = workPtr[k][(j+lower-k)];
+				workPtr[k][(j+lower-k)] = workPtr[r][(j+lower-r)];
+				workPtr[r][(j+lower-r)] = temp;
+			}
+			temp = workPtr[k][rhs];
+			workPtr[k][rhs] = workPtr[r][rhs];
+			workPtr[r][rhs] = temp;
+		}
+
+		/* Eliminate Column k From The Rows Below */
+		for(r=k+1; r<=last; r++)
+		{
+			if(workPtr[r][(k+lower-r)].numerator == 0)
+				continue;
+
+			multiplier = divide(workPtr[r][(k+lower-r)], workPtr[k][lower]);
+			for(j=k; j<=reach; j++)
+				if(workPtr[k][(j+lower-k)].numerator != 0)
+					workPtr[r][(j+lower-r)] = subtract(workPtr[r][(j+lower-r)], multiply(multiplier, workPtr[k][(j+lower-k)]));
+			workPtr[r][rhs] = subtract(workPtr[r][rhs], multiply(multiplier, workPtr[k][rhs]));
+
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+	}
+
+	/* Back Substitution */
+	for(i=eqCount; i>0; i--)
+	{
+		k = i-1;
+		reach = ((k+lower+upper) < eqCount) ? (k+lower+upper) : (eqCount-1);
+
+		temp = workPtr[k][rhs];
+		for(j=k+1; j<=reach; j++)
+			if(workPtr[k][(j+lower-k)].numerator != 0)
+				temp = subtract(temp, multiply(workPtr[k][(j+lower-k)], solutionCoefficient[j]));
+		solutionCoefficient[k] = divide(temp, workPtr[k][lower]);
+
+		if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+	}
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to solve a system held in band
+	storage.
+
+	Parameters: 
+		None
+
+	Returns:
+		Same as solveSystem(), or 0 if the system is singular (or the
+		elimination overflowed) and must go through the regular path.
+*/
+unsigned int eqsolver::solveBandStorage(void)
+{
+	struct fraction **workPtr;
+	unsigned int i, j, status;
+
+	workPtr = createBandWork(bandLower, bandUpper);
+	if(workPtr == NULL)
+		return MEMORY_ERROR;
+
+	/* Same Layout As The Band, Extra Diagonals Start Zero */
+	for(i=0; i<eqCount; i++)
+	{
+		for(j=0; j<=(unsigned int)(bandLower+bandUpper); j++)
+			workPtr[i][j] = bandCoefficient[i][j];
+		workPtr[i][((2*bandLower)+bandUpper+1)] = bandCoefficient[i][(bandLower+bandUpper+1)];
+	}
+
+	status = eliminateBand(workPtr, bandLower, bandUpper);
+	destroyMatrix(workPtr);
+
+	if(status == OVERFLOW)
+	{
+		overFlow = 0;	/* Let The Regular Path Try Its Pivot Order */
+		return 0;
+	}
+	if(status == SOLVED)
+		status = verifySolution(solutionCoefficient, SOLVED);
+
+	if(status == SOLVED)
+	{
+		/* Every Column Is A Pivot Column */
+		for(i=0; i<eqCount; i++)
+			pivotColumn[i] = (unsigned short int)(i+1);
+		pivotCount = eqCount;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to detect a narrow band in the
+	working copy of a system held in regular storage and, if found,
+	solve it with eliminateBand().
+
+	Parameters: 
+		coeffPtr - working copy (not altered)
+
+	Returns:
+		0 if the system was not solved here (band too wide, singular
+		or overflow). Otherwise SOLVED or MEMORY_ERROR.
+*/
+unsigned int eqsolver::bandSolve(struct fraction **coeffPtr)
+{
+	struct fraction **workPtr;
+	unsigned int i, j, lower, upper, first, last, status;
+
+	lower = upper = 0;
+	for(i=0; i<eqCount; i++)
+		for(j=0; j<eqCount; j++)
+			if(coeffPtr[i][j].numerator != 0)
+			{
+				if((j < i) && ((i-j) > lower))
+					lower = i-j;
+				if((j > i) && ((j-i) > upper))
+					upper = j-i;
+			}
+
+	/* Only Worth It While The Band Is A Small Part Of The Matrix */
+	if((((2*lower)+upper+2)*4) > eqCount)
+		return 0;
+
+	workPtr = createBandWork(lower, upper);
+	if(workPtr == NULL)
+		return MEMORY_ERROR;
+
+	for(i=0; i<eqCount; i++)
+	{
+		first = (i > lower) ? (i-lower) : 0;
+		last = ((i+upper) < eqCount) ? (i+upper) : (eqCount-1);
+		for(j=first; j<=last; j++)
+			workPtr[i][(j+lower-i)] = coeffPtr[i][j];
+		workPtr[i][((2*lower)+upper+1)] = coeffPtr[i][eqCount];
+	}
+
+	status = eliminateBand(workPtr, lower, upper);
+	destroyMatrix(workPtr);
+
+	if(status == OVERFLOW)
+	{
+		overFlow = 0;	/* Let The Dense Path Try Its Pivot Order */
+		return 0;
+	}
+	if(status != SOLVED)
+		return 0;
+
+	status = verifySolution(solutionCoefficient, SOLVED);
+	if(status == SOLVED)
+	{
+		/* Every Column Is A Pivot Column */
+		for(i=0; i<eqCount; i++)
+			pivotColumn[i] = (unsigned short int)(i+1);
+		pivotCount = eqCount;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to allocate storage for a
+	symmetric system. Only the upper triangle and the RHS are kept,
+	halving memory, and solveSystem() runs a fraction-free LDL'
+	elimination which only updates the upper triangle. Setting a
+	coefficient also sets its mirror image across the diagonal.
+	Calling a function which needs the full matrix (determinant(),
+	factorSystem(), addEquation(), ...) converts the system to regular
+	storage.
+
+	Parameters: 
+		count - # of simultaneous equations (see setSystemEqCount())
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+unsigned int eqsolver::setSystemSymmetric(unsigned short int count)
+{
+	unsigned int i, j;
+
+	/* No Need To Allocate Space, Empty System */
+	if(count == 0)
+		return 1;
+
+	eqCount = count;
+	streamRank = 0;	/* No Equations Absorbed Yet */
+	streamStatus = 0;
+
+	symmetricCoefficient = (struct fraction **) allocateMemory(count * sizeof(struct fraction *));
+	solutionCoefficient = (struct fraction *) allocateMemory(count * sizeof(struct fraction));
+	pivotColumn = (unsigned short int *) allocateMemory(count * sizeof(unsigned short int));
+
+	if((symmetricCoefficient == NULL) || (solutionCoefficient == NULL) || (pivotColumn == NULL))
+		return 0;
+
+	for(i=0; i<count; i++)
+	{
+		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
+		solutionCoefficient[i].sign = 0;
+		symmetricCoefficient[i] = NULL;
+	}
+
+	/* Allocate & Zero Initialize Rows: Diagonal Onwards, Then RHS */
+	for(i=0; i<count; i++)
+	{
+		symmetricCoefficient[i] = (struct fraction *) allocateMemory((count-i+1) * sizeof(struct fraction));
+		if(symmetricCoefficient[i] == NULL)
+			return 0;
+
+		for(j=0; j<=(count-i); j++)
+		{
+			symmetricCoefficient[i][j].numerator = symmetricCoefficient[i][j].denominator = 0;
+			symmetricCoefficient[i][j].sign = 0;
+		}
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to solve a system held in
+	symmetric storage with a fraction-free (Bareiss) LDL' elimination.
+	The matrix is scaled to integers by a single factor, which keeps
+	it symmetric, and every step only updates the upper triangle of
+	the trailing submatrix. Pivots are taken from the diagonal, with
+	the matching row & column swapped in. Back substitution yields
+	det*x exactly, as 64-bit integers.
+
+	Parameters: 
+		None
+
+	Returns:
+		SOLVED, MEMORY_ERROR, or 0 if the system must go through the
+		regular path (singular, no nonzero diagonal pivot left, or
+		64/32-bit overflow).
+*/
+unsigned int eqsolver::solveSymmetricStorage(void)
+{
+	INT64 **intPtr;
+	INT64 *rhs, *scaled;
+	unsigned int *order;
+	unsigned int i, j, k, p, status;
+	INT64 scale, rhsScale, previousPivot, product1, product2, temp;
+	UINT64 factor, common;
+	struct fraction value;
+
+	intPtr = (INT64 **) allocateMemory(eqCount * sizeof(INT64 *));
+	rhs = (INT64 *) allocateMemory(eqCount * sizeof(INT64));
+	scaled = (INT64 *) allocateMemory(eqCount * sizeof(INT64));
+	order = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+
+	if(intPtr != NULL)
+		for(i=0; i<eqCount; i++)
+			intPtr[i] = NULL;
+
+	status = MEMORY_ERROR;
+	if((intPtr != NULL) && (rhs != NULL) && (scaled != NULL) && (order != NULL))
+	{
+		status = 0;
+		for(i=0; i<eqCount; i++)
+		{
+			intPtr[i] = (INT64 *) allocateMemory((eqCount-i) * sizeof(INT64));
+			if(intPtr[i] == NULL)
+			{
+				status = MEMORY_ERROR;
+				break;
+			}
+		}
+	}
+
+	/* Common Multiple Of Coefficient & RHS Denominators */
+	scale = rhsScale = 1;
+	for(i=0; (status == 0) && (i<eqCount); i++)
+	{
+		for(j=0; j<=(eqCount-i); j++)
+		{
+			value = symmetricCoefficient[i][j];
+			if(value.numerator == 0)
+				continue;	/* Zero, Denominator Is Meaningless */
+
+			if(j == (eqCount-i))
+			{
+				factor = (UINT64)value.denominator / gcd64((UINT64)rhsScale, (UINT64)value.denominator);
+				multiply64(rhsScale, (INT64)factor, rhsScale);
+			}
+			else
+			{
+				factor = (UINT64)value.denominator / gcd64((UINT64)scale, (UINT64)value.denominator);
+				multiply64(scale, (INT64)factor, scale);
+			}
+		}
+		if(overFlow)
+			status = OVERFLOW;
+	}
+
+	/* Scale To Integers */
+	for(i=0; (status == 0) && (i<eqCount); i++)
+	{
+		order[i] = i;
+		for(j=0; j<=(eqCount-i); j++)
+		{
+			value = symmetricCoefficient[i][j];
+			temp = 0;
+			if(value.numerator != 0)
+				multiply64((INT64)value.numerator, ((j == (eqCount-i)) ? rhsScale : scale) / (INT64)value.denominator, temp);
+			if(value.sign == 1)
+				temp = -temp;
+			if(j == (eqCount-i))
+				rhs[i] = temp;
+			else
+				intPtr[i][j] = temp;
+		}
+		if(overFlow)
+			status = OVERFLOW;
+	}
+
+	/* Bareiss Elimination On The Upper Triangle, Entry (i,j) Is intPtr[i][j-i] */
+	previousPivot = 1;
+	for(k=0; (status == 0) && (k<eqCount); k++)
+	{
+		for(p=k; p<eqCount; p++)
+			if(intPtr[p][0] != 0)
+				break;
+		if(p == eqCount)
+		{
+			status = NO_SOLUTIONS;	/* Singular Or Needs A 2x2 Pivot */
+			break;
+		}
+
+		/* Symmetric Swap Of Index k & p (Rows Above k Included, Their Columns Swap) */
+		if(p != k)
+		{
+			for(i=0; i<eqCount; i++)
+			{
+				if((i == k) || (i == p))
+					continue;
+				if(i < k)
+				{
+					temp = intPtr[i][(k-i)];
+					intPtr[i][(k-i)] = intPtr[i][(p-i)];
+					intPtr[i][(p-i)] = temp;
+				}
+				else if(i < p)
+				{
+					temp = intPtr[k][(i-k)];
+					intPtr[k][(i-k)] = intPtr[i][(p-i)];
+					intPtr[i][(p-i)] = temp;
+				}
+				else
+				{
+					temp = intPtr[k][(i-k)];
+					intPtr[k][(i-k)] = intPtr[p][(i-p)];
+					intPtr[p][(i-p)] = temp;
+				}
+			}
+			temp = intPtr[k][0];
+			intPtr[k][0] = intPtr[p][0];
+			intPtr[p][0] = temp;
+			temp = rhs[k];
+			rhs[k] = rhs[p];
+			rhs[p] = temp;
+			j = order[k];
+			order[k] = order[p];
+			order[p] = j;
+		}
+
+		/* Update Trailing Upper Triangle & RHS */
+		for(i=k+1; (status == 0) && (i<eqCount); i++)
+		{
+			for(j=i; j<eqCount; j++)
+			{
+				if(!multiply64(intPtr[k][0], intPtr[i][(j-i)], product1) ||
+					!multiply64(intPtr[k][(i-k)], intPtr[k][(j-k)], product2) ||
+					!subtract64(product1, product2, product1))
+				{
+					status = OVERFLOW;
+					break;
+				}
+				intPtr[i][(j-i)] = product1 / previousPivot;	/* Exact Division */
+			}
+			if(status != 0)
+				break;
+
+			if(!multiply64(intPtr[k][0], rhs[i], product1) ||
+				!multiply64(intPtr[k][(i-k)], rhs[k], product2) ||
+				!subtract64(product1, product2, product1))
+			{
+				status = OVERFLOW;
+				break;
+			}
+			rhs[i] = product1 / previousPivot;
+		}
+
+		previousPivot = intPtr[k][0];
+	}
+
+	/* Back Substitution: scaled[k] = det * y[k], det = Last Pivot */
+	for(i=eqCount; (status == 0) && (i>0); i--)
+	{
+		k = i-1;
+		if(!multiply64(previousPivot, rhs[k], product1))
+		{
+			status = OVERFLOW;
+			break;
+		}
+		for(j=k+1; j<eqCount; j++)
+		{
+			if(!multiply64(intPtr[k][(j-k)], scaled[j], product2) ||
+				!subtract64(product1, product2, product1))
+			{
+				status = OVERFLOW;
+				break;
+			}
+		}
+		if(status != 0)
+			break;
+		scaled[k] = product1 / intPtr[k][0];	/* Exact Division */
+	}
+
+	/* x = (scale / rhsScale) * y, Reduced To 32-bit Fractions */
+	for(k=0; (status == 0) && (k<eqCount); k++)
+	{
+		if(!multiply64(scaled[k], scale, product1) ||
+			!multiply64(previousPivot, rhsScale, product2))
+		{
+			status = OVERFLOW;
+			break;
+		}
+
+		value.sign = ((product1 < 0) != (product2 < 0)) ? 1 : 0;
+		if(product1 < 0)
+			product1 = -product1;
+		if(product2 < 0)
+			product2 = -product2;
+		if(product1 == 0)
+		{
+			value.numerator = value.denominator = 0;
+			value.sign = 0;
+		}
+		else
+		{
+			common = gcd64((UINT64)product1, (UINT64)product2);
+			product1 /= (INT64)common;
+			product2 /= (INT64)common;
+			if((product1 > UINT32MAX) || (product2 > UINT32MAX))
+			{
+				status = OVERFLOW;
+				break;
+			}
+			value.numerator = (unsigned int) product1;
+			value.denominator = (unsigned int) product2;
+		}
+
+		solutionCoefficient[order[k]] = value;
+	}
+
+	if(status == 0)
+		status = verifySolution(solutionCoefficient, SOLVED);
+
+	if(status == SOLVED)
+	{
+		/* Every Column Is A Pivot Column */
+		for(i=0; i<eqCount; i++)
+			pivotColumn[i] = (unsigned short int)(i+1);
+		pivotCount = eqCount;
+	}
+	else if(status != MEMORY_ERROR)
+	{
+		overFlow = 0;	/* Let The Regular Path Classify It */
+		status = 0;
+	}
+
+	destroyIntegerMatrix(intPtr);
+	if(rhs != NULL) releaseMemory(rhs);
+	if(scaled != NULL) releaseMemory(scaled);
+	if(order != NULL) releaseMemory(order);
+
+	return status;
+}
+
+/*	The purpose of this function is to solve a Toeplitz system (every
+	diagonal constant, T[i][j] = t[i-j]) given only its first column
+	and first row, in O(N^2) by Levinson recursion. The generators are
+	kept as the system's storage, so the system can be examined and
+	solved again like any other; setting a coefficient (other than the
+	RHS) converts it to regular storage. Any system previously set up
+	is released first (see cleanup()).
+
+	Parameters: 
+		count - # of simultaneous equations
+		firstColumn - count values, T[0][0] .. T[count-1][0]
+		firstRow - count values, T[0][0] .. T[0][count-1]
+				(firstRow[0] is ignored, firstColumn[0] is used)
+		rhs - count values
+
+	Returns:
+		Same as solveSystem(). Systems with a singular leading
+		submatrix are solved by the regular path.
+*/
+unsigned int eqsolver::solveToeplitz(unsigned short int count, const short int *firstColumn, const short int *firstRow, const short int *rhs)
+{
+	unsigned int i;
+
+	if(!prepareStructure(count, (2*(unsigned int)count) - 1))
+		return MEMORY_ERROR;
+
+	/* Generator (count-1)+k Holds t[k], k = -(count-1) .. count-1 */
+	for(i=0; i<count; i++)
+	{
+		structureGenerator[((count-1)+i)] = makeFraction(firstColumn[i], 1);
+		if(i > 0)
+			structureGenerator[((count-1)-i)] = makeFraction(firstRow[i], 1);
+		structureRHS[i] = makeFraction(rhs[i], 1);
+	}
+	structureType = STRUCTURE_TOEPLITZ;
+
+	return solveSystem();
+}
+
+/*	The purpose of this function is to solve a Vandermonde system,
+	V[i][j] = nodes[i]^j (the coefficients of the polynomial of degree
+	count-1 taking the value rhs[i] at nodes[i]), in O(N^2) by the
+	Bjorck-Pereyra algorithm. The nodes are kept as the system's
+	storage, as for solveToeplitz(). Any system previously set up is
+	released first (see cleanup()).
+
+	Parameters: 
+		count - # of simultaneous equations
+		nodes - count values
+		rhs - count values
+
+	Returns:
+		Same as solveSystem(). Systems with repeated nodes are solved
+		by the regular path.
+*/
+unsigned int eqsolver::solveVandermonde(unsigned short int count, const short int *nodes, const short int *rhs)
+{
+	unsigned int i;
+
+	if(!prepareStructure(count, count))
+		return MEMORY_ERROR;
+
+	for(i=0; i<count; i++)
+	{
+		structureGenerator[i] = makeFraction(nodes[i], 1);
+		structureRHS[i] = makeFraction(rhs[i], 1);
+	}
+	structureType = STRUCTURE_VANDERMONDE;
+
+	return solveSystem();
+}
+
+/*	The purpose of this function is to release any system set up and
+	allocate the storage of a structured (Toeplitz or Vandermonde)
+	system.
+
+	Parameters: 
+		count - # of simultaneous equations
+		generatorCount - # of generating values
+
+	Returns:
+		1 on success, 0 on allocation errors.
+*/
+int eqsolver::prepareStructure(unsigned short int count, unsigned int generatorCount)
+{
+	unsigned int i;
+
+	cleanup();
+
+	if(count == 0)
+		return 0;
+
+	solutionCoefficient = (struct fraction *) allocateMemory(count * sizeof(struct fraction));
+	pivotColumn = (unsigned short int *) allocateMemory(count * sizeof(unsigned short int));
+	structureGenerator = (struct fraction *) allocateMemory(generatorCount * sizeof(struct fraction));
+	structureRHS = (struct fraction *) allocateMemory(count * sizeof(struct fraction));
+
+	if((solutionCoefficient == NULL) || (pivotColumn == NULL) || (structureGenerator == NULL) || (structureRHS == NULL))
+	{
+		cleanup();
+		return 0;
+	}
+
+	eqCount = count;
+	streamRank = 0;	/* No Equations Absorbed Yet */
+	streamStatus = 0;
+	for(i=0; i<count; i++)
+	{
+		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
+		solutionCoefficient[i].sign = 0;
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to compute a coefficient of a
+	structured system from its generators. Vandermonde powers may set
+	overFlow.
+
+	Parameters: 
+		row - matrix row # (starting at 0)
+		column - matrix column # (starting at 0), eqCount for the RHS
+
+	Returns:
+		The coefficient.
+*/
+struct fraction eqsolver::structuredValue(unsigned int row, unsigned int column)
+{
+	struct fraction value;
+	unsigned int k;
+
+	if(column == eqCount)
+		return structureRHS[row];
+
+	if(structureType == STRUCTURE_TOEPLITZ)
+		return structureGenerator[((eqCount-1)+row-column)];
+
+	/* Vandermonde: nodes[row]^column */
+	value.numerator = value.denominator = 1;
+	value.sign = 0;
+	for(k=0; k<column; k++)
+		value = multiply(value, structureGenerator[row]);
+
+	return value;
+}
+
+/*	The purpose of this function is to solve a Toeplitz system held in
+	structured storage by Levinson recursion: the forward & backward
+	vectors (T f = e1, T b = eN) and the solution of each leading
+	submatrix are extended by one in O(N) per step.
+
+	Parameters: 
+		None
+
+	Returns:
+		SOLVED, MEMORY_ERROR, or 0 if a leading submatrix is singular
+		(or on overflow) and the regular path must take over.
+*/
+unsigned int eqsolver::levinsonSolve(void)
+{
+	struct fraction *forward, *backward, *nextForward, *nextBackward;
+	struct fraction one, errorForward, errorBackward, errorSolution, scale, shifted, current;
+	struct fraction *t;
+	unsigned int i, j, status;
+
+	t = &structureGenerator[(eqCount-1)];	/* t[k], k = -(eqCount-1) .. eqCount-1 */
+
+	forward = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+	backward = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+	nextForward = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+	nextBackward = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+
+	status = MEMORY_ERROR;
+	if((forward != NULL) && (backward != NULL) && (nextForward != NULL) && (nextBackward != NULL))
+		status = (t[0].numerator == 0) ? NO_SOLUTIONS : 0;
+
+	one.numerator = one.denominator = 1;
+	one.sign = 0;
+
+	if(status == 0)
+	{
+		forward[0] = backward[0] = divide(one, t[0]);
+		solutionCoefficient[0] = divide(structureRHS[0], t[0]);
+	}
+
+	for(i=1; (status == 0) && (i<eqCount); i++)
+	{
+		/* Residuals Of The Extended Vectors In The New Row / Column */
+		errorForward.numerator = errorForward.denominator = 0;
+		errorForward.sign = 0;
+		errorBackward = errorSolution = errorForward;
+		for(j=0; j<i; j++)
+		{
+			errorForward = add(errorForward, multiply(t[(int)(i-j)], forward[j]));
+			errorBackward = add(errorBackward, multiply(t[-(int)(j+1)], backward[j]));
+			errorSolution = add(errorSolution, multiply(t[(int)(i-j)], solutionCoefficient[j]));
+		}
+
+		scale = subtract(one, multiply(errorForward, errorBackward));
+		if(overFlow)
+		{
+			status = OVERFLOW;
+			break;
+		}
+		if(scale.numerator == 0)
+		{
+			status = NO_SOLUTIONS;	/* Singular Leading Submatrix */
+			break;
+		}
+
+		for(j=0; j<=i; j++)
+		{
+			if(j < i)
+				current = forward[j];
+			else
+				current.numerator = current.denominator = current.sign = 0;
+			if(j > 0)
+				shifted = backward[(j-1)];
+			else
+				shifted.numerator = shifted.denominator = shifted.sign = 0;
+
+			nextForward[j] = divide(subtract(current, multiply(errorForward, shifted)), scale);
+			nextBackward[j] = divide(subtract(shifted, multiply(errorBackward, current)), scale);
+		}
+
+		for(j=0; j<=i; j++)
+		{
+			forward[j] = nextForward[j];
+			backward[j] = nextBackward[j];
+		}
+
+		/* Extend Solution Along The New Backward Vector */
+		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
+		solutionCoefficient[i].sign = 0;
+		scale = subtract(structureRHS[i], errorSolution);
+		for(j=0; j<=i; j++)
+			solutionCoefficient[j] = add(solutionCoefficient[j], multiply(scale, backward[j]));
+
+		if(overFlow)
+			status = OVERFLOW;
+	}
+
+	if(status == 0)
+		status = verifySolution(solutionCoefficient, SOLVED);
+
+	if(forward != NULL) releaseMemory(forward);
+	if(backward != NULL) releaseMemory(backward);
+	if(nextForward != NULL) releaseMemory(nextForward);
+	if(nextBackward != NULL) releaseMemory(nextBackward);
+
+	return status;
+}
+
+/*	The purpose of this function is to solve a Vandermonde system held
+	in structured storage by the Bjorck-Pereyra algorithm: Newton
+	divided differences, then conversion of the Newton form to monomial
+	coefficients. The solution is checked by Horner's rule, O(N^2)
+	like the rest.
+
+	Parameters: 
+		None
+
+	Returns:
+		SOLVED, NO_SOLUTIONS, or 0 if nodes repeat (or on overflow) and
+		the regular path must take over.
+*/
+unsigned int eqsolver::bjorckPereyraSolve(void)
+{
+	struct fraction *nodes, *c, difference, value;
+	unsigned int i, k;
+
+	nodes = structureGenerator;
+	c = solutionCoefficient;
+
+	for(i=0; i<eqCount; i++)
+		c[i] = structureRHS[i];
+
+	/* Divided Differences */
+	for(k=0; k<(unsigned int)(eqCount-1); k++)
+	{
+		for(i=eqCount-1; i>k; i--)
+		{
+			difference = subtract(nodes[i], nodes[(i-k-1)]);
+			if(difference.numerator == 0)
+				return NO_SOLUTIONS;	/* Repeated Node */
+			c[i] = divide(subtract(c[i], c[(i-1)]), difference);
+		}
+		if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+	}
+
+	/* Newton Form To Monomial Coefficients */
+	for(k=eqCount-1; k>0; k--)
+	{
+		for(i=k-1; i<(unsigned int)(eqCount-1); i++)
+			c[i] = subtract(c[i], multiply(c[(i+1)], nodes[(k-1)]));
+		if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+	}
+
+	/* Check Each Equation By Horner's Rule */
+	for(i=0; i<eqCount; i++)
+	{
+		value = c[(eqCount-1)];
+		for(k=eqCount-1; k>0; k--)
+			value = add(multiply(value, nodes[i]), c[(k-1)]);
+		if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+
+		difference = subtract(value, structureRHS[i]);
+		if(difference.numerator != 0)
+			return NO_SOLUTIONS;
+	}
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to solve a system held in
+	structured storage with the algorithm matching its structure.
+
+	Parameters: 
+		None
+
+	Returns:
+		Same as solveSystem(), or 0 if the regular path must take over.
+*/
+unsigned int eqsolver::solveStructureStorage(void)
+{
+	unsigned int i, status;
+
+	if(structureType == STRUCTURE_TOEPLITZ)
+		status = levinsonSolve();
+	else
+		status = bjorckPereyraSolve();
+
+	if(status == SOLVED)
+	{
+		/* Every Column Is A Pivot Column */
+		for(i=0; i<eqCount; i++)
+			pivotColumn[i] = (unsigned short int)(i+1);
+		pivotCount = eqCount;
+	}
+	else if(status != MEMORY_ERROR)
+	{
+		overFlow = 0;	/* Let The Regular Path Classify It */
+		status = 0;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to solve the working copy by
+	splitting it into block triangular form. A matching pairs every
+	unknown with an equation holding it, and the strongly connected
+	components (Tarjan) of the resulting dependency graph are the
+	diagonal blocks. Each block is solved by its own eqsolver (1x1
+	blocks directly) once the unknowns it depends on are known, and
+	blocks whose dependencies are all known are solved in parallel.
+	Systems that are irreducible, structurally singular or have a
+	singular block are left to solveDense().
+
+	Parameters: 
+		coeffPtr - working copy (not altered)
+
+	Returns:
+		0 if the system was not solved here. Otherwise SOLVED,
+		MEMORY_ERROR or OVERFLOW as for solveSystem().
+*/
+unsigned int eqsolver::blockSolve(struct fraction **coeffPtr)
+{
+	struct blockWork work;
+	unsigned int status;
+
+	if(eqCount < 2)
+		return 0;
+
+	work.count = eqCount;
+	work.coeffPtr = coeffPtr;
+	work.solution = solutionCoefficient;
+	work.account = activeAccount();
+	work.owner = this;
+	work.parallel = 0;
+	work.rowColumn = NULL;
+	work.rowStart = (unsigned int *) allocateMemory((eqCount+1) * sizeof(unsigned int));
+	work.columnMatch = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.columnBlock = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.columnPosition = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.blockStart = (unsigned int *) allocateMemory((eqCount+1) * sizeof(unsigned int));
+	work.blockColumn = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.blockLevel = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.blockStatus = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.levelStart = (unsigned int *) allocateMemory((eqCount+1) * sizeof(unsigned int));
+	work.levelBlock = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+
+	if((work.rowStart == NULL) || (work.columnMatch == NULL) || (work.columnBlock == NULL) ||
+		(work.columnPosition == NULL) || (work.blockStart == NULL) || (work.blockColumn == NULL) || (work.blockLevel == NULL) ||
+		(work.blockStatus == NULL) || (work.levelStart == NULL) || (work.levelBlock == NULL))
+		status = MEMORY_ERROR;
+	else
+		status = solveBlocks(work);
+
+	if(work.rowStart != NULL) releaseMemory(work.rowStart);
+	if(work.rowColumn != NULL) releaseMemory(work.rowColumn);
+	if(work.columnMatch != NULL) releaseMemory(work.columnMatch);
+	if(work.columnBlock != NULL) releaseMemory(work.columnBlock);
+	if(work.columnPosition != NULL) releaseMemory(work.columnPosition);
+	if(work.blockStart != NULL) releaseMemory(work.blockStart);
+	if(work.blockColumn != NULL) releaseMemory(work.blockColumn);
+	if(work.blockLevel != NULL) releaseMemory(work.blockLevel);
+	if(work.blockStatus != NULL) releaseMemory(work.blockStatus);
+	if(work.levelStart != NULL) releaseMemory(work.levelStart);
+	if(work.levelBlock != NULL) releaseMemory(work.levelBlock);
+
+	return status;
+}
+
+/*	The purpose of this function is to carry out blockSolve() once its
+	workspace is allocated.
+
+	Parameters: 
+		work - block workspace
+
+	Returns:
+		Same as blockSolve().
+*/
+unsigned int eqsolver::solveBlocks(struct blockWork &work)
+{
+	unsigned int i, j, k, block, level, levelCount, parallelCount, status;
+	struct fraction **coeffPtr = work.coeffPtr;
+
+	/* Nonzero Pattern, Row By Row */
+	work.rowStart[0] = 0;
+	for(i=0; i<eqCount; i++)
+	{
+		work.rowStart[(i+1)] = work.rowStart[i];
+		for(j=0; j<eqCount; j++)
+			if(coeffPtr[i][j].numerator != 0)
+				work.rowStart[(i+1)]++;
+	}
+	work.rowColumn = (unsigned int *) allocateMemory((work.rowStart[eqCount]+1) * sizeof(unsigned int));
+	if(work.rowColumn == NULL)
+		return MEMORY_ERROR;
+	for(i=0, k=0; i<eqCount; i++)
+		for(j=0; j<eqCount; j++)
+			if(coeffPtr[i][j].numerator != 0)
+				work.rowColumn[k++] = j;
+
+	/* Diagonal Blocks: One Block = Nothing To Gain */
+	status = matchColumns(work);
+	if(status == SOLVED)
+		status = findBlocks(work);
+	if(status == NO_SOLUTIONS)
+		return 0;	/* Structurally Singular */
+	if(status != SOLVED)
+		return status;
+	if(work.blockCount < 2)
+		return 0;
+
+	/* Level Of A Block: One More Than The Blocks It Depends On */
+	levelCount = 0;
+	for(block=0; block<work.blockCount; block++)
+	{
+		level = 0;
+		for(i=work.blockStart[block]; i<work.blockStart[(block+1)]; i++)
+		{
+			j = work.columnMatch[work.blockColumn[i]];
+			for(k=work.rowStart[j]; k<work.rowStart[(j+1)]; k++)
+				if((work.columnBlock[work.rowColumn[k]] != block) &&
+					(work.blockLevel[work.columnBlock[work.rowColumn[k]]] >= level))
+					level = work.blockLevel[work.columnBlock[work.rowColumn[k]]] + 1;
+		}
+		work.blockLevel[block] = level;
+		if(level >= levelCount)
+			levelCount = level + 1;
+	}
+
+	/* Group Blocks By Level */
+	for(level=0; level<=levelCount; level++)
+		work.levelStart[level] = 0;
+	for(block=0; block<work.blockCount; block++)
+		work.levelStart[(work.blockLevel[block]+1)]++;
+	for(level=0; level<levelCount; level++)
+		work.levelStart[(level+1)] += work.levelStart[level];
+	for(block=0; block<work.blockCount; block++)
+		work.levelBlock[work.levelStart[work.blockLevel[block]]++] = block;
+	for(level=levelCount; level>0; level--)
+		work.levelStart[level] = work.levelStart[(level-1)];
+	work.levelStart[0] = 0;
+
+	/* Solve Level By Level, Blocks Of A Level Are Independent */
+	for(level=0; level<levelCount; level++)
+	{
+		work.firstTask = work.levelStart[level];
+		k = work.levelStart[(level+1)] - work.firstTask;
+
+		/* Threads Only Pay Off For Blocks Larger Than 1x1 */
+		parallelCount = 0;
+		for(i=work.firstTask; i<work.levelStart[(level+1)]; i++)
+			if((work.blockStart[(work.levelBlock[i]+1)] - work.blockStart[work.levelBlock[i]]) > 1)
+				parallelCount++;
+
+		work.parallel = (parallelCount > 1) && (threadCount != 1);
+		if(work.parallel)
+			runParallel(activeAccount(), threadCount, k, solveBlockTask, &work);
+		else
+			for(i=0; i<k; i++)
+				solveBlockTask(&work, i);
+
+		for(i=work.firstTask; i<work.levelStart[(level+1)]; i++)
+		{
+			status = work.blockStatus[work.levelBlock[i]];
+			if(status == MEMORY_ERROR)
+				return status;
+			if(status != SOLVED)
+				return 0;	/* Singular Block Or Overflow, Let solveDense() Decide */
+		}
+	}
+
+	status = verifySolution(solutionCoefficient, SOLVED);
+	if(status == SOLVED)
+	{
+		/* Every Column Is A Pivot Column */
+		for(i=0; i<eqCount; i++)
+			pivotColumn[i] = (unsigned short int)(i+1);
+		pivotCount = eqCount;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to pair every column with a row
+	holding a nonzero coefficient in it (maximum bipartite matching by
+	augmenting paths, with a cheap lookahead for unmatched columns).
+
+	Parameters: 
+		work - block workspace, rowStart & rowColumn filled in;
+			columnMatch is filled in
+
+	Returns:
+		SOLVED if every column was matched, NO_SOLUTIONS if the
+		system is structurally singular, MEMORY_ERROR on allocation
+		errors.
+*/
+unsigned int eqsolver::matchColumns(struct blockWork &work)
+{
+	unsigned int *pathRow, *pathPosition, *lookahead, *visited;
+	unsigned int row, column, depth, found, status;
+
+	pathRow = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	pathPosition = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	lookahead = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	visited = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+
+	if((pathRow == NULL) || (pathPosition == NULL) || (lookahead == NULL) || (visited == NULL))
+		status = MEMORY_ERROR;
+	else
+		status = SOLVED;
+
+	for(column=0; (status == SOLVED) && (column<work.count); column++)
+	{
+		work.columnMatch[column] = work.count;	/* Unmatched */
+		visited[column] = work.count;
+	}
+
+	for(row=0; (status == SOLVED) && (row<work.count); row++)
+		lookahead[row] = work.rowStart[row];
+
+	for(row=0; (status == SOLVED) && (row<work.count); row++)
+	{
+		depth = 0;
+		pathRow[0] = row;
+		pathPosition[0] = work.rowStart[row];
+		found = work.count;
+
+		/* Depth-First Search For An Augmenting Path */
+		for(;;)
+		{
+			/* Cheap: Unmatched Column In Current Row */
+			for(; lookahead[pathRow[depth]]<work.rowStart[(pathRow[depth]+1)]; lookahead[pathRow[depth]]++)
+			{
+				column = work.rowColumn[lookahead[pathRow[depth]]];
+				if(work.columnMatch[column] == work.count)
+				{
+					found = column;
+					break;
+				}
+			}
+			if(found != work.count)
+				break;
+
+			/* Otherwise Follow A Matched Column Not Yet Visited */
+			while(pathPosition[depth] < work.rowStart[(pathRow[depth]+1)])
+			{
+				column = work.rowColumn[pathPosition[depth]];
+				if(visited[column] != row)
+					break;
+				pathPosition[depth]++;
+			}
+			if(pathPosition[depth] < work.rowStart[(pathRow[depth]+1)])
+			{
+				visited[column] = row;
+				pathPosition[depth]++;
+				depth++;
+				pathRow[depth] = work.columnMatch[column];
+				pathPosition[depth] = work.rowStart[pathRow[depth]];
+			}
+			else if(depth == 0)
+				break;
+			else
+				depth--;
+		}
+
+		if(found == work.count)
+		{
+			status = NO_SOLUTIONS;	/* Row Can Not Be Matched */
+			break;
+		}
+
+		/* Augment: Each Row On The Path Takes The Column It Followed */
+		work.columnMatch[found] = pathRow[depth];
+		while(depth > 0)
+		{
+			depth--;
+			work.columnMatch[work.rowColumn[(pathPosition[depth]-1)]] = pathRow[depth];
+		}
+	}
+
+	if(pathRow != NULL) releaseMemory(pathRow);
+	if(pathPosition != NULL) releaseMemory(pathPosition);
+	if(lookahead != NULL) releaseMemory(lookahead);
+	if(visited != NULL) releaseMemory(visited);
+
+	return status;
+}
+
+/*	The purpose of this function is to find the diagonal blocks of the
+	matched system: the strongly connected components (Tarjan) of the
+	graph with an edge from each column to the other columns of its
+	matched row. Components are found in dependency order, so a block
+	only depends on blocks before it.
+
+	Parameters: 
+		work - block workspace, columnMatch filled in; blockCount,
+			blockStart, blockColumn & columnBlock are filled in
+
+	Returns:
+		SOLVED, or MEMORY_ERROR on allocation errors.
+*/
+unsigned int eqsolver::findBlocks(struct blockWork &work)
+{
+	unsigned int *order, *low, *componentStack, *callStack, *callPosition;
+	unsigned int column, next, row, depth, stackCount, visitCount, emitCount;
+
+	order = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	low = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	componentStack = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	callStack = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+	callPosition = (unsigned int *) allocateMemory(work.count * sizeof(unsigned int));
+
+	if((order == NULL) || (low == NULL) || (componentStack == NULL) || (callStack == NULL) ||
+		(callPosition == NULL))
+	{
+		if(order != NULL) releaseMemory(order);
+		if(low != NULL) releaseMemory(low);
+		if(componentStack != NULL) releaseMemory(componentStack);
+		if(callStack != NULL) releaseMemory(callStack);
+		if(callPosition != NULL) releaseMemory(callPosition);
+		return MEMORY_ERROR;
+	}
+
+	/* columnBlock Doubles As "On componentStack" Mark Until Assigned */
+	for(column=0; column<work.count; column++)
+	{
+		order[column] = work.count;	/* Not Visited */
+		work.columnBlock[column] = work.count;
+	}
+
+	work.blockCount = 0;
+	work.blockStart[0] = 0;
+	stackCount = visitCount = emitCount = 0;
+
+	for(column=0; column<work.count; column++)
+	{
+		if(order[column] != work.count)
+			continue;
+
+		depth = 0;
+		callStack[0] = column;
+		callPosition[0] = work.rowStart[work.columnMatch[column]];
+		order[column] = low[column] = visitCount++;
+		componentStack[stackCount++] = column;
+
+		while(1)
+		{
+			row = work.columnMatch[callStack[depth]];
+			if(callPosition[depth] < work.rowStart[(row+1)])
+			{
+				next = work.rowColumn[callPosition[depth]++];
+				if(order[next] == work.count)
+				{
+					/* Descend */
+					depth++;
+					callStack[depth] = next;
+					callPosition[depth] = work.rowStart[work.columnMatch[next]];
+					order[next] = low[next] = visitCount++;
+					componentStack[stackCount++] = next;
+				}
+				else if((work.columnBlock[next] == work.count) && (order[next] < low[callStack[depth]]))
+					low[callStack[depth]] = order[next];
+				continue;
+			}
+
+			/* All Edges Done, Emit Component If Root */
+			next = callStack[depth];
+			if(low[next] == order[next])
+			{
+				do
+				{
+					stackCount--;
+					work.columnBlock[componentStack[stackCount]] = work.blockCount;
+					work.blockColumn[emitCount++] = componentStack[stackCount];
+				} while(componentStack[stackCount] != next);
+				work.blockCount++;
+				work.blockStart[work.blockCount] = emitCount;
+			}
+
+			if(depth == 0)
+				break;
+			depth--;
+			if(low[next] < low[callStack[depth]])
+				low[callStack[depth]] = low[next];
+		}
+	}
+
+	releaseMemory(order);
+	releaseMemory(low);
+	releaseMemory(componentStack);
+	releaseMemory(callStack);
+	releaseMemory(callPosition);
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to run solveBlock() for one block
+	of the current level on a fresh eqsolver, so threads never share
+	an overflow flag. It is the task handed to runParallel().
+
+	Parameters: 
+		context - the blockWork
+		index - task # within the current level
+
+	Returns:
+		None (see blockStatus)
+*/
+void eqsolver::solveBlockTask(void *context, unsigned int index)
+{
+	struct blockWork *work = (struct blockWork *) context;
+	eqsolver worker;
+
+	worker.parentAccount = work->account;
+	worker.solveBlock(*work, work->levelBlock[(work->firstTask + index)]);
+}
+
+/*	The purpose of this function is to solve one diagonal block once
+	the unknowns it depends on are known. Their terms are moved to the
+	RHS; a 1x1 block is then solved directly, a larger one by a nested
+	eqsolver.
+
+	Parameters: 
+		work - block workspace
+		block - block # to solve
+
+	Returns:
+		None. The block's unknowns are stored in work.solution and
+		work.blockStatus[block] is set to SOLVED, NO_SOLUTIONS,
+		INFINITE_SOLUTIONS, MEMORY_ERROR or OVERFLOW.
+*/
+void eqsolver::solveBlock(struct blockWork &work, unsigned int block)
+{
+	unsigned int i, k, size, row, column, first;
+	struct fraction value;
+	eqsolver sub;
+
+	first = work.blockStart[block];
+	size = work.blockStart[(block+1)] - first;
+
+	if(size == 1)
+	{
+		column = work.blockColumn[first];
+		row = work.columnMatch[column];
+		value = work.coeffPtr[row][work.count];
+		for(k=work.rowStart[row]; k<work.rowStart[(row+1)]; k++)
+			if(work.rowColumn[k] != column)
+				value = subtract(value, multiply(work.coeffPtr[row][work.rowColumn[k]], work.solution[work.rowColumn[k]]));
+		work.solution[column] = divide(value, work.coeffPtr[row][column]);
+		work.blockStatus[block] = overFlow ? OVERFLOW : SOLVED;
+		return;
+	}
+
+	work.owner->inheritSettings(sub);
+	if(work.parallel)
+		sub.threadCount = 1;	/* Blocks Of This Level Run In Parallel, Set Before Their Rows Are Placed */
+	sub.parentAccount = activeAccount();
+	sub.compactEnabled = 0;	/* Filled With Fractions Below */
+	if(!sub.setSystemEqCount((unsigned short int) size))
+	{
+		sub.cleanup();
+		work.blockStatus[block] = MEMORY_ERROR;
+		return;
+	}
+
+	/* Block Columns Are Numbered In blockColumn Order */
+	for(i=0; i<size; i++)
+		work.columnPosition[work.blockColumn[(first+i)]] = i;
+
+	for(i=0; i<size; i++)
+	{
+		row = work.columnMatch[work.blockColumn[(first+i)]];
+		value = work.coeffPtr[row][work.count];
+		for(k=work.rowStart[row]; k<work.rowStart[(row+1)]; k++)
+		{
+			column = work.rowColumn[k];
+			if(work.columnBlock[column] == block)
+				sub.originalCoefficient[i][work.columnPosition[column]] = work.coeffPtr[row][column];
+			else
+				value = subtract(value, multiply(work.coeffPtr[row][column], work.solution[column]));
+		}
+		sub.originalCoefficient[i][size] = value;
+	}
+
+	if(overFlow)
+		work.blockStatus[block] = OVERFLOW;
+	else
+	{
+		sub.presolveEnabled = 0;
+		sub.componentEnabled = 0;
+		sub.blockEnabled = 0;
+		work.blockStatus[block] = sub.solveSystem();
+		if(work.blockStatus[block] == SOLVED)
+			for(i=0; i<size; i++)
+				work.solution[work.blockColumn[(first+i)]] = sub.solutionCoefficient[i];
+	}
+
+	sub.cleanup();
+}
+
+/*	The purpose of this function is to solve a large working copy by
+	cache-blocked (tiled) Gaussian elimination. Pivots are taken a panel
+	of tileSize columns at a time: the panel is factored on its own,
+	leaving the multipliers in place, and the other columns are then
+	updated tile by tile, every tile receiving the whole panel while it
+	is in cache instead of the whole matrix streaming through cache
+	once per pivot. Each coefficient still receives its updates in
+	pivot order, so the exact values are those of unblocked
+	elimination. Back substitution then gives the solution, exact by
+	construction, so it is not verified.
+
+	Parameters: 
+		coeffPtr - working copy to operate on (altered)
+
+	Returns:
+		SOLVED, MEMORY_ERROR, or 0 if the system is too small to tile, a
+		column has no pivot (coeffPtr is then an equivalent system, left
+		partially reduced, for solveDense() to classify) or on overflow
+		(coeffPtr is then copied from originalCoefficient again).
+*/
+unsigned int eqsolver::tiledSolve(struct fraction **coeffPtr)
+{
+	struct tileWork work;
+	unsigned int status, i, j, taskCount, size;
+	struct fraction sum, pivot;
+
+	size = eliminationTileSize();
+	if(eqCount < (2*size))
+		return 0;	/* Fewer Than Two Panels, Nothing Gained */
+
+	work.count = eqCount;
+	work.coeffPtr = coeffPtr;
+	work.tileSize = size;
+	work.panelCount = (eqCount+size-1) / size;
+
+	/* Step k Has 1 + (P-k) + (P-k-1)(P-k) Tasks, P = panelCount */
+	taskCount = 0;
+	for(i=0; i<work.panelCount; i++)
+		taskCount += 1 + (work.panelCount-i) + ((work.panelCount-i-1) * (work.panelCount-i));
+
+	work.pivotRow = (unsigned int *) allocateMemory(eqCount * sizeof(unsigned int));
+	work.pivotEnd = (unsigned int *) allocateMemory(work.panelCount * sizeof(unsigned int));
+	work.panelSkipped = (unsigned char *) allocateMemory(work.panelCount * sizeof(unsigned char));
+	work.stepStart = (unsigned int *) allocateMemory((work.panelCount+1) * sizeof(unsigned int));
+	work.waiting = (unsigned int *) allocateMemory(taskCount * sizeof(unsigned int));
+	work.taskOverflow = (unsigned char *) allocateMemory(taskCount * sizeof(unsigned char));
+
+	if((work.pivotRow == NULL) || (work.pivotEnd == NULL) || (work.panelSkipped == NULL) ||
+		(work.stepStart == NULL) || (work.waiting == NULL) || (work.taskOverflow == NULL))
+		status = MEMORY_ERROR;
+	else
+	{
+		memset(work.taskOverflow, 0, taskCount * sizeof(unsigned char));
+		status = eliminateTiles(work);
+	}
+
+	if(work.pivotRow != NULL) releaseMemory(work.pivotRow);
+	if(work.pivotEnd != NULL) releaseMemory(work.pivotEnd);
+	if(work.panelSkipped != NULL) releaseMemory(work.panelSkipped);
+	if(work.stepStart != NULL) releaseMemory(work.stepStart);
+	if(work.waiting != NULL) releaseMemory(work.waiting);
+	if(work.taskOverflow != NULL) releaseMemory(work.taskOverflow);
+
+	/* Back Substitution, Each Row Divided By Its Pivot First As In
+		Gauss-Jordan Elimination (Keeps Denominators Small) */
+	for(i=eqCount; (i>0) && (status == SOLVED); i--)
+	{
+		pivot = coeffPtr[(i-1)][(i-1)];
+		sum = divide(coeffPtr[(i-1)][eqCount], pivot);
+		for(j=eqCount-1; j>=i; j--)
+			if(coeffPtr[(i-1)][j].numerator != 0)
+				sum = subtract(sum, multiply(divide(coeffPtr[(i-1)][j], pivot), solutionCoefficient[j]));
+		solutionCoefficient[(i-1)] = sum;
+		if(overFlow)
+			status = OVERFLOW;
+	}
+
+	if(status == OVERFLOW)
+	{
+		/* Values Differ From Those Of Gauss-Jordan Elimination, Which
+			May Not Overflow: Start solveDense() Over From The Original */
+		copyOriginal(coeffPtr);
+		overFlow = 0;
+		return 0;
+	}
+
+	if(status == SOLVED)
+	{
+		/* Every Column Is A Pivot Column */
+		for(i=0; i<eqCount; i++)
+			pivotColumn[i] = (unsigned short int)(i+1);
+		pivotCount = eqCount;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to run the tiled elimination as a
+	graph of tile tasks on the work-stealing scheduler (runGraph()).
+	Step k (panel k) consists of:
+	- factor: factorPanel() on column tile k, rows k onwards
+	- solve: for each column tile t right of it, the panel's row swaps
+	and its update of the panel's own rows (they become rows of U)
+	- update: for each row tile below the panel and each such column
+	tile t, the update by the panel
+	A task runs as soon as the tasks writing what it reads are done, so
+	there is no barrier between steps: the next panel is factored
+	while updates of the previous step are still running (lookahead),
+	and threads keep busy as long as any tile is ready. Column tile
+	panelCount holds the RHS.
+
+	Parameters: 
+		work - tile workspace (all arrays allocated)
+
+	Returns:
+		SOLVED (upper triangular, ready for back substitution),
+		OVERFLOW, MEMORY_ERROR, or 0 if a column has no pivot.
+*/
+unsigned int eqsolver::eliminateTiles(struct tileWork &work)
+{
+	struct taskGraph graph;
+	unsigned int panel, panels, width, i, t, index, first, last;
+
+	panels = work.panelCount;
+
+	/* Predecessor Counts, Step By Step (See tileSuccessors()) */
+	index = 0;
+	for(panel=0; panel<panels; panel++)
+	{
+		width = panels - panel;	/* Column Tiles Right Of The Panel, RHS Included */
+		work.stepStart[panel] = index;
+		work.waiting[index++] = (panel > 0) ? width : 0;
+		for(t=0; t<width; t++)
+			work.waiting[index++] = (panel > 0) ? (width+1) : 1;
+		for(i=panel+1; i<panels; i++)
+			for(t=0; t<width; t++)
+				work.waiting[index++] = (panel > 0) ? 2 : 1;
+	}
+	work.stepStart[panels] = index;
+
+	graph.task = runTileTask;
+	graph.successors = tileSuccessors;
+	graph.owner = tileOwner;
+	graph.context = &work;
+	graph.taskCount = index;
+	graph.maxSuccessors = panels;
+	graph.waiting = work.waiting;
+
+	if(!runGraph(activeAccount(), threadCount, &graph))
+		return MEMORY_ERROR;
+
+	for(index=0; index<graph.taskCount; index++)
+		if(work.taskOverflow[index])
+			return OVERFLOW;
+
+	for(panel=0; panel<panels; panel++)
+	{
+		first = panel * work.tileSize;
+		last = ((first+work.tileSize) < work.count) ? (first+work.tileSize) : work.count;
+		if(work.pivotEnd[panel] < last)
+		{
+			/* No Pivot In Column pivotEnd, Multipliers Applied, Clear Them */
+			for(t=0; t<work.pivotEnd[panel]; t++)
+				for(i=t+1; i<work.count; i++)
+					work.coeffPtr[i][t].numerator = work.coeffPtr[i][t].denominator = work.coeffPtr[i][t].sign = 0;
+			return 0;
+		}
+	}
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to find the task # of a tile task.
+
+	Parameters: 
+		work - tile workspace
+		panel - step #
+		row - row tile # (panel for factor & solve tasks)
+		column - column tile # (panel for the factor task)
+
+	Returns:
+		Task #.
+*/
+unsigned int eqsolver::tileTaskIndex(struct tileWork &work, unsigned int panel, unsigned int row, unsigned int column)
+{
+	unsigned int width = work.panelCount - panel;
+
+	if(column == panel)
+		return work.stepStart[panel];	/* Factor */
+	if(row == panel)
+		return work.stepStart[panel] + 1 + (column-panel-1);	/* Solve */
+	return work.stepStart[panel] + 1 + width + ((row-panel-1) * width) + (column-panel-1);	/* Update */
+}
+
+/*	The purpose of this function is to find which step, row tile and
+	column tile a task # stands for.
+
+	Parameters: 
+		work - tile workspace
+		index - task #
+		panel, row, column - receive the step #, row tile # & column
+				tile # (as for tileTaskIndex())
+
+	Returns:
+		None
+*/
+void eqsolver::decodeTileTask(struct tileWork &work, unsigned int index, unsigned int &panel, unsigned int &row, unsigned int &column)
+{
+	unsigned int low, high, width, offset;
+
+	/* Step: Last stepStart Not Past index */
+	low = 0;
+	high = work.panelCount - 1;
+	while(low < high)
+	{
+		panel = (low+high+1) / 2;
+		if(work.stepStart[panel] <= index)
+			low = panel;
+		else
+			high = panel - 1;
+	}
+	panel = low;
+
+	width = work.panelCount - panel;
+	offset = index - work.stepStart[panel];
+	if(offset == 0)
+		row = column = panel;
+	else if(offset <= width)
+	{
+		row = panel;
+		column = panel + offset;
+	}
+	else
+	{
+		offset -= width + 1;
+		row = panel + 1 + (offset / width);
+		column = panel + 1 + (offset % width);
+	}
+}
+
+/*	The purpose of this function is to run one tile task on a fresh
+	eqsolver, so threads never share an overflow flag. It is the task
+	handed to runGraph(). Once a panel turns out singular the tasks of
+	later steps do nothing.
+
+	Parameters: 
+		context - the tileWork
+		index - task #
+
+	Returns:
+		1 on overflow (the tasks depending on it are skipped), else 0.
+*/
+int eqsolver::runTileTask(void *context, unsigned int index)
+{
+	struct tileWork *work = (struct tileWork *) context;
+	eqsolver worker;
+	unsigned int panel, row, column, size, first, last, firstColumn, lastColumn, firstRow, lastRow;
+
+	decodeTileTask(*work, index, panel, row, column);
+	size = work->tileSize;
+	first = panel * size;
+	last = ((first+size) < work->count) ? (first+size) : work->count;
+	if(column < work->panelCount)
+	{
+		firstColumn = column * size;
+		lastColumn = ((firstColumn+size) < work->count) ? (firstColumn+size) : work->count;
+	}
+	else
+	{
+		firstColumn = work->count;	/* RHS */
+		lastColumn = work->count + 1;
+	}
+
+	if(column == panel)
+	{
+		/* Factor, Unless An Earlier Panel Is Singular */
+		work->panelSkipped[panel] = (panel > 0) && (work->panelSkipped[(panel-1)] || (work->pivotEnd[(panel-1)] < first));
+		if(work->panelSkipped[panel])
+			work->pivotEnd[panel] = first;
+		else
+			work->pivotEnd[panel] = worker.factorPanel(*work, first, last);
+	}
+	else if(!work->panelSkipped[panel])
+	{
+		if(row == panel)
+		{
+			/* Solve: Swaps, Then Rows Of The Panel Top Down */
+			worker.applySwaps(*work, first, work->pivotEnd[panel], firstColumn, lastColumn);
+			worker.updateTile(work->coeffPtr, first, work->pivotEnd[panel], first, last, firstColumn, lastColumn);
+		}
+		else
+		{
+			/* Update Rows Below The Panel */
+			firstRow = row * size;
+			lastRow = ((firstRow+size) < work->count) ? (firstRow+size) : work->count;
+			worker.updateTile(work->coeffPtr, first, work->pivotEnd[panel], firstRow, lastRow, firstColumn, lastColumn);
+		}
+	}
+
+	work->taskOverflow[index] = (unsigned char) worker.overFlow;
+	return worker.overFlow;
+}
+
+/*	The purpose of this function is to tell which worker owns a tile
+	task: the owner of its row tile, the same worker which placed those
+	rows (see placeRows()), so rows stay with one worker (and NUMA node)
+	from step to step. It is the owner function handed to runGraph().
+
+	Parameters: 
+		context - the tileWork
+		index - task #
+
+	Returns:
+		Row tile # (runGraph() takes it modulo the # of threads).
+*/
+unsigned int eqsolver::tileOwner(void *context, unsigned int index)
+{
+	unsigned int panel, row, column;
+
+	decodeTileTask(*(struct tileWork *) context, index, panel, row, column);
+
+	return row;
+}
+
+/*	The purpose of this function is to list the tasks depending on a
+	tile task. It is the successor function handed to runGraph().
+	- factor k: solve (k, t) for every column tile t right of panel k
+	- solve (k, t): update (k, i, t) for every row tile i below panel k
+	- update (k, i, t): factor k+1 if t is panel k+1's column tile,
+	else solve (k+1, t), and update (k+1, i, t) if row tile i is below
+	panel k+1
+
+	Parameters: 
+		context - the tileWork
+		index - task #
+		list - receives the task #s
+
+	Returns:
+		# of tasks listed.
+*/
+unsigned int eqsolver::tileSuccessors(void *context, unsigned int index, unsigned int *list)
+{
+	struct tileWork *work = (struct tileWork *) context;
+	unsigned int panel, row, column, i, count;
+
+	decodeTileTask(*work, index, panel, row, column);
+
+	count = 0;
+	if(column == panel)
+	{
+		for(i=panel+1; i<=work->panelCount; i++)
+			list[count++] = tileTaskIndex(*work, panel, panel, i);
+	}
+	else if(row == panel)
+	{
+		for(i=panel+1; i<work->panelCount; i++)
+			list[count++] = tileTaskIndex(*work, panel, i, column);
+	}
+	else if(column == (panel+1))
+		list[count++] = tileTaskIndex(*work, (panel+1), (panel+1), (panel+1));
+	else
+	{
+		list[count++] = tileTaskIndex(*work, (panel+1), (panel+1), column);
+		if(row > (panel+1))
+			list[count++] = tileTaskIndex(*work, (panel+1), row, column);
+	}
+
+	return count;
+}
+
+/*	The purpose of this function is to factor one panel of columns:
+	for each column a pivot row is swapped in, and the rows below it
+	are reduced within the panel only, their multipliers left where
+	the eliminated coefficients were. Rows are only swapped within the
+	panel's columns; the swaps are recorded in pivotRow for
+	applySwaps().
+
+	Parameters: 
+		work - tile workspace
+		first, last - panel columns (last excluded)
+
+	Returns:
+		last, or the first column without a pivot. Check overFlow after
+		calling.
+*/
+unsigned int eqsolver::factorPanel(struct tileWork &work, unsigned int first, unsigned int last)
+{
+	struct fraction **coeffPtr = work.coeffPtr;
+	struct fraction temp;
+	unsigned int column, row, i, j;
+
+	for(column=first; column<last; column++)
+	{
+		for(row=column; row<work.count; row++)
+			if(coeffPtr[row][column].numerator != 0)
+				break;
+		if(row == work.count)
+			return column;
+
+		work.pivotRow[column] = row;
+		if(row != column)
+			for(j=first; j<last; j++)
+			{
+				temp = coeffPtr[column][j];
+				coeffPtr[column][j] = coeffPtr[row][j];
+				coeffPtr[row][j] = temp;
+			}
+
+		for(i=column+1; i<work.count; i++)
+		{
+			if(coeffPtr[i][column].numerator == 0)
+				continue;	/* Column Already Clear */
+
+			coeffPtr[i][column] = divide(coeffPtr[i][column], coeffPtr[column][column]);
+			subtractScaledRow(coeffPtr[i], coeffPtr[column], coeffPtr[i][column], (column+1), last);
+			if(overFlow) return column;	/* Overflow Occurred, No Use To Continue */
+		}
+	}
+
+	return last;
+}
+
+/*	The purpose of this function is to carry out the row swaps
+	factorPanel() recorded in other columns.
+
+	Parameters: 
+		work - tile workspace
+		first, last - pivots whose swaps to apply (last excluded)
+		firstColumn, lastColumn - columns to swap (lastColumn excluded)
+
+	Returns:
+		None
+*/
+void eqsolver::applySwaps(struct tileWork &work, unsigned int first, unsigned int last,
+						  unsigned int firstColumn, unsigned int lastColumn)
+{
+	struct fraction temp;
+	unsigned int column, row, j;
+
+	for(column=first; column<last; column++)
+	{
+		row = work.pivotRow[column];
+		if(row == column)
+			continue;
+
+		for(j=firstColumn; j<lastColumn; j++)
+		{
+			temp = work.coeffPtr[column][j];
+			work.coeffPtr[column][j] = work.coeffPtr[row][j];
+			work.coeffPtr[row][j] = temp;
+		}
+	}
+}
+
+/*	The purpose of this function is to apply the multipliers of a
+	factored panel to one tile of the working copy. Each row receives
+	the pivots above it in order, so rows of the panel itself must be
+	processed top down.
+
+	Parameters: 
+		coeffPtr - working copy to operate on (altered)
+		firstPivot, lastPivot - pivot rows (& columns) of the panel
+					(lastPivot excluded)
+		firstRow, lastRow - tile rows (lastRow excluded)
+		firstColumn, lastColumn - tile columns (lastColumn excluded)
+
+	Returns:
+		Returns nothing. Check overFlow after calling.
+*/
+void eqsolver::updateTile(struct fraction **coeffPtr, unsigned int firstPivot, unsigned int lastPivot,
+						  unsigned int firstRow, unsigned int lastRow, unsigned int firstColumn, unsigned int lastColumn)
+{
+	unsigned int row, pivot;
+
+	for(row=firstRow; row<lastRow; row++)
+	{
+		for(pivot=firstPivot; (pivot<lastPivot) && (pivot<row); pivot++)
+		{
+			if(coeffPtr[row][pivot].numerator == 0)
+				continue;	/* Nothing To Subtract */
+
+			subtractScaledRow(coeffPtr[row], coeffPtr[pivot], coeffPtr[row][pivot], firstColumn, lastColumn);
+			if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+		}
+	}
+}
+
+/*	The purpose of this function is to run solveDense() with
+	checkpoints, resuming from the checkpoint file if asked to and it
+	holds a checkpoint of this system. The file is removed once the
+	elimination ends, whatever the outcome.
+
+	Parameters: 
+		coeffPtr - working copy (a copy of the "original" matrix)
+		resume - 1 = continue from the checkpoint file if possible
+
+	Returns:
+		Same as solveSystem().
+*/
+unsigned int eqsolver::checkpointSolve(struct fraction **coeffPtr, int resume)
+{
+	unsigned int i, status, tiles;
+	unsigned short int first;
+
+	checkpointRowTiles = (eqCount+tileSize-1) / tileSize;
+	checkpointColumnTiles = (eqCount+tileSize) / tileSize;	/* RHS Included */
+	tiles = checkpointRowTiles * checkpointColumnTiles;
+	checkpointFingerprint = fingerprintSystem();
+	checkpointStamp = (unsigned int *) allocateMemory(tiles * sizeof(unsigned int));
+	if(checkpointStamp == NULL)
+		return MEMORY_ERROR;
+
+	first = 0;
+	if(!resume || !loadCheckpoint(coeffPtr, first))
+	{
+		/* Start Over, Each Slot Written In Full The First Time */
+		checkpointFile = fopen(checkpointPath, "w+b");
+		checkpointSequence = 1;
+		checkpointHeld[0] = checkpointHeld[1] = 0;
+		for(i=0; i<tiles; i++)
+			checkpointStamp[i] = 1;
+	}
+
+	if(checkpointFile == NULL)
+		status = MEMORY_ERROR;
+	else
+		status = solveDense(coeffPtr, first);
+
+	if(checkpointFile != NULL)
+	{
+		fclose((FILE *) checkpointFile);
+		remove(checkpointPath);
+	}
+	checkpointFile = NULL;
+	releaseMemory(checkpointStamp);
+	checkpointStamp = NULL;
+
+	return status;
+}
+
+/*	The purpose of this function is to hash the "original" matrix, so
+	a checkpoint is only resumed for the system it was taken of.
+
+	Parameters: 
+		None
+
+	Returns:
+		FNV-1a hash of eqCount & all coefficients.
+*/
+unsigned int eqsolver::fingerprintSystem(void)
+{
+	unsigned int hash, i, j;
+	struct fraction value;
+
+	hash = 2166136261U;
+	hash = (hash ^ eqCount) * 16777619U;
+	for(i=0; i<eqCount; i++)
+	{
+		for(j=0; j<=eqCount; j++)
+		{
+			value = originalValue(i, j);
+			if(value.numerator == 0)
+				continue;	/* Zero Has Several Forms */
+			hash = (hash ^ ((i * (eqCount+1)) + j)) * 16777619U;
+			hash = (hash ^ value.numerator) * 16777619U;
+			hash = (hash ^ value.denominator) * 16777619U;
+			hash = (hash ^ value.sign) * 16777619U;
+		}
+	}
+
+	return hash;
+}
+
+/*	The purpose of this function is to record that a row changes from
+	a column on: the tiles it crosses are stamped with the # of the
+	next checkpoint, which must write them. Gauss-Jordan elimination
+	of a column only changes values in that column & the ones to its
+	right.
+
+	Parameters: 
+		row - row changed (starting at 0)
+		column - first column changed (starting at 0)
+
+	Returns:
+		None
+*/
+void eqsolver::markCheckpoint(unsigned int row, unsigned int column)
+{
+	unsigned int *tileStamp;
+	unsigned int tile;
+
+	if(checkpointStamp == NULL)
+		return;
+
+	tileStamp = &checkpointStamp[((row / tileSize) * checkpointColumnTiles)];
+	for(tile=(column / tileSize); tile<checkpointColumnTiles; tile++)
+		tileStamp[tile] = checkpointSequence;
+}
+
+/*	The purpose of this function is to locate a tile in the checkpoint
+	file. The file holds two slots, written in turn, so one complete
+	checkpoint survives a crash while the other is being written: two
+	headers, then the tiles of slot 0, then those of slot 1. Tiles
+	follow row tile by row tile, each tileSize x tileSize fractions
+	(edge tiles padded), rows of a tile one after another.
+
+	Parameters: 
+		slot - 0 or 1
+		rowTile - row tile #
+		columnTile - column tile #
+
+	Returns:
+		Offset of the tile in bytes.
+*/
+UINT64 eqsolver::checkpointOffset(unsigned int slot, unsigned int rowTile, unsigned int columnTile)
+{
+	UINT64 tileBytes;
+
+	tileBytes = (UINT64) tileSize * tileSize * sizeof(struct fraction);
+
+	return 2 * sizeof(struct checkpointHeader) +
+		((UINT64) slot * checkpointRowTiles * checkpointColumnTiles + (UINT64) rowTile * checkpointColumnTiles + columnTile) * tileBytes;
+}
+
+/* Positions A Checkpoint File, Offsets May Exceed 2GB */
+static int seekFile(FILE *file, UINT64 offset)
+{
+#ifdef GCC_BUILD
+	return fseeko(file, (off_t) offset, SEEK_SET);
+#else
+	return _fseeki64(file, (INT64) offset, SEEK_SET);
+#endif
+}
+
+/* Forces A Checkpoint File To Disk */
+static int syncFile(FILE *file)
+{
+	if(fflush(file) != 0)
+		return -1;
+#ifdef GCC_BUILD
+	return fsync(fileno(file));
+#else
+	return _commit(_fileno(file));
+#endif
+}
+
+/*	The purpose of this function is to write a checkpoint into the
+	slot holding the older one: the tiles changed since that one was
+	taken, then the slot's header naming the next pivot. The header is
+	marked invalid while tiles are written, so a torn slot is never
+	resumed; the other slot still holds the previous checkpoint. A
+	failing write only loses this checkpoint, elimination carries on.
+
+	Parameters: 
+		coeffPtr - working copy
+		next - next pivot row & column
+
+	Returns:
+		None
+*/
+void eqsolver::writeCheckpoint(struct fraction **coeffPtr, unsigned int next)
+{
+	struct checkpointHeader header;
+	FILE *file = (FILE *) checkpointFile;
+	unsigned int slot, rowTile, columnTile, row, lastRow, firstColumn, width;
+	int failed;
+
+	slot = checkpointSequence % 2;
+
+	header.magic = CHECKPOINT_MAGIC;
+	header.valid = 0;
+	header.sequence = checkpointSequence;
+	header.count = eqCount;
+	header.tileSize = tileSize;
+	header.row = next;
+	header.column = next;
+	header.tier = CHECKPOINT_TIER;
+	header.fingerprint = checkpointFingerprint;
+
+	failed = (seekFile(file, slot * sizeof(header)) != 0) || (fwrite(&header, sizeof(header), 1, file) != 1) || (syncFile(file) != 0);
+
+	for(rowTile=0; (rowTile<checkpointRowTiles) && !failed; rowTile++)
+	{
+		lastRow = ((rowTile+1) * tileSize < eqCount) ? ((rowTile+1) * tileSize) : eqCount;
+		for(columnTile=0; (columnTile<checkpointColumnTiles) && !failed; columnTile++)
+		{
+			if(checkpointStamp[(rowTile * checkpointColumnTiles + columnTile)] <= checkpointHeld[slot])
+				continue;	/* Unchanged Since The Slot Was Written */
+
+			firstColumn = columnTile * tileSize;
+			width = ((eqCount+1-firstColumn) < tileSize) ? (eqCount+1-firstColumn) : tileSize;
+			failed = (seekFile(file, checkpointOffset(slot, rowTile, columnTile)) != 0);
+			for(row=rowTile*tileSize; (row<lastRow) && !failed; row++)
+				failed = (fwrite(&coeffPtr[row][firstColumn], sizeof(struct fraction), width, file) != width);
+		}
+	}
+
+	if(!failed)
+		failed = (syncFile(file) != 0);
+	if(!failed)
+	{
+		header.valid = 1;
+		failed = (seekFile(file, slot * sizeof(header)) != 0) || (fwrite(&header, sizeof(header), 1, file) != 1) || (syncFile(file) != 0);
+	}
+
+	/* A Failed Slot Keeps Its Old #, Its Next Write Covers Everything Since */
+	if(!failed)
+		checkpointHeld[slot] = checkpointSequence;
+	checkpointSequence++;
+}
+
+/*	The purpose of this function is to load the working copy from the
+	newest valid slot of the checkpoint file, if that is a checkpoint
+	of this system taken with the same tile size & arithmetic.
+
+	Parameters: 
+		coeffPtr - working copy (a copy of the "original" matrix,
+				overwritten)
+		first - receives the pivot row & column to continue from
+
+	Returns:
+		1 if loaded (checkpointFile is then open for further
+		checkpoints), 0 if there is nothing to resume (coeffPtr is then
+		a copy of the "original" matrix again).
+*/
+int eqsolver::loadCheckpoint(struct fraction **coeffPtr, unsigned short int &first)
+{
+	struct checkpointHeader header[2];
+	FILE *file;
+	unsigned int slot, other, i, rowTile, columnTile, row, lastRow, firstColumn, width;
+	int usable[2], failed;
+
+	file = fopen(checkpointPath, "r+b");
+	if(file == NULL)
+		return 0;
+
+	for(slot=0; slot<2; slot++)
+	{
+		usable[slot] = (fread(&header[slot], sizeof(header[slot]), 1, file) == 1) &&
+			(header[slot].magic == CHECKPOINT_MAGIC) && (header[slot].valid == 1) &&
+			(header[slot].count == eqCount) && (header[slot].tileSize == tileSize) &&
+			(header[slot].row == header[slot].column) && (header[slot].row < eqCount) &&
+			(header[slot].tier == CHECKPOINT_TIER) && (header[slot].fingerprint == checkpointFingerprint);
+	}
+
+	slot = (usable[1] && (!usable[0] || (header[1].sequence > header[0].sequence))) ? 1 : 0;
+	other = 1-slot;
+	if(!usable[slot])
+	{
+		fclose(file);
+		return 0;
+	}
+
+	failed = 0;
+	for(rowTile=0; (rowTile<checkpointRowTiles) && !failed; rowTile++)
+	{
+		lastRow = ((rowTile+1) * tileSize < eqCount) ? ((rowTile+1) * tileSize) : eqCount;
+		for(columnTile=0; (columnTile<checkpointColumnTiles) && !failed; columnTile++)
+		{
+			firstColumn = columnTile * tileSize;
+			width = ((eqCount+1-firstColumn) < tileSize) ? (eqCount+1-firstColumn) : tileSize;
+			failed = (seekFile(file, checkpointOffset(slot, rowTile, columnTile)) != 0);
+			for(row=rowTile*tileSize; (row<lastRow) && !failed; row++)
+				failed = (fread(&coeffPtr[row][firstColumn], sizeof(struct fraction), width, file) != width);
+		}
+	}
+
+	if(failed)
+	{
+		copyOriginal(coeffPtr);
+		fclose(file);
+		return 0;
+	}
+
+	/* Which Tiles Differ In The Other Slot Is Unknown: All, As Of The
+		Loaded Checkpoint (Which The Loaded Slot Holds Already) */
+	checkpointSequence = header[slot].sequence + 1;
+	checkpointHeld[slot] = header[slot].sequence;
+	checkpointHeld[other] = usable[other] ? header[other].sequence : 0;
+	for(i=0; i<(checkpointRowTiles * checkpointColumnTiles); i++)
+		checkpointStamp[i] = header[slot].sequence;
+
+	checkpointFile = file;
+	first = (unsigned short int) header[slot].row;
+
+	return 1;
+}
+
+/*	The purpose of this function is to run the Gauss-Jordan
+	elimination on a working copy of the "original" matrix. While
+	checkpointing (see setCheckpoint()) the rows each pivot changes are
+	recorded and the working copy is written out every
+	checkpointInterval pivots.
+
+	Parameters: 
+		coeffPtr - working copy to operate on (altered)
+		first - first pivot row & column, the ones before are already
+				reduced (0 unless resuming from a checkpoint)
+
+	Returns:
+		Same as solveSystem().
+*/
+unsigned int eqsolver::solveDense(struct fraction **coeffPtr, unsigned short int first)
+{
+	unsigned int i;
+	unsigned int row, column, nonZeroFound;
+	int rowCounter;
+	struct fraction multiplier;
+	unsigned int status;
+
+	row = first;
+	column = first;
+
+	/* While Each Column Not Reduced */
+	while(column < eqCount)
+	{
+		/* If [row, column] = 0, Perform Full Pivoting */
+		if(coeffPtr[row][column].numerator == 0)
+		{
+			rowCounter = row+1;	/* Check For Replacement Below Only */
+			nonZeroFound = 0;	/* Set Flag */
+
+			while(rowCounter < eqCount)	/* Process All Rows Below */
+			{
+				/* If Suitable Pivot Found, Swap Rows */
+				if(coeffPtr[rowCounter][column].numerator != 0)
+				{
+					swapRows((row+1), (rowCounter+1), coeffPtr);
+					markCheckpoint(rowCounter, column);
+					nonZeroFound = 1;
+					break;
+				}
+				else	/* Proceed To Check Next Possible Pivot */
+					rowCounter = rowCounter+1;
+			}
+
+			/* Ultimately Will Be Infinite Or No Solutions, Columns Left
+				Of This One Are Already Reduced So Carry On From Here */
+			if(!nonZeroFound)
+				return finishReducedEchelon(coeffPtr, row);
+		}
+		
+		markCheckpoint(row, column);
+
+		/* Is Pivot-Point = 1? If Not, Divide To Make It So */
+		if(!((coeffPtr[row][column].numerator == 1) && (coeffPtr[row][column].denominator == 1) && (coeffPtr[row][column].sign == 0)))
+		{	
+			divideMatrixRow((row+1), coeffPtr[row][column], coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		/* Make Pivot -1 */
+		for(i=0; i<=eqCount; i++)
+		{	
+			if(coeffPtr[(row)][i].numerator == 0)
+				continue;
+			
+			if(coeffPtr[(row)][i].sign == 0)
+				coeffPtr[(row)][i].sign = 1;
+			else
+				coeffPtr[(row)][i].sign = 0;
+		}
+
+		/* Clear Out Column Above Row */
+		for(rowCounter=row-1; rowCounter>=0; rowCounter--)
+		{
+			if(coeffPtr[rowCounter][column].numerator == 0)
+					continue;	/* Column Already Clear */
+			
+			multiplier = coeffPtr[rowCounter][column];
+			markCheckpoint(rowCounter, column);
+			multiplyMatrixRow((row+1), multiplier, coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			addMatrixRows((rowCounter+1), (row+1), coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			divideMatrixRow((row+1), multiplier, coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		/* Clear Out Column Below Row */
+		for(rowCounter=row+1; rowCounter<eqCount; rowCounter++)
+		{
+			if(coeffPtr[rowCounter][column].numerator == 0)
+					continue;	/* Column Already Clear */
+			
+			multiplier = coeffPtr[rowCounter][column];
+			markCheckpoint(rowCounter, column);
+			multiplyMatrixRow((row+1), multiplier, coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			addMatrixRows((rowCounter+1), (row+1), coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			divideMatrixRow((row+1), multiplier, coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		/* Make Pivot -1 */
+		for(i=0; i<=eqCount; i++)
+		{
+			if(coeffPtr[(row)][i].numerator == 0)
+				continue;
+			if(coeffPtr[(row)][i].sign == 0)
+				coeffPtr[(row)][i].sign = 1;
+			else
+				coeffPtr[(row)][i].sign = 0;
+		}
+		
+		/* Proceed To Next Pivot Point */
+		row++;	
+		column++;
+
+		if((checkpointStamp != NULL) && ((column % checkpointInterval) == 0) && (column < eqCount))
+			writeCheckpoint(coeffPtr, column);
+	}
+
+	/* System IS In Reduced Echolon Form But The Solution
+		May Be Incorrect, Thus It Needs To Be Checked */
+	for(i=0; i<eqCount; i++)
+		solutionCoefficient[i] = coeffPtr[i][eqCount];
+
+	status = verifySolution(solutionCoefficient, SOLVED);
+	if(status != SOLVED)
+		return status;
+
+	/* Every Column Is A Pivot Column */
+	for(i=0; i<eqCount; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = eqCount;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to check a candidate solution
+	against the "original" matrix coefficients.
+
+	Parameters: 
+		solution - array of eqCount fractions to check
+		status - value to return if the solution checks out
+
+	Returns:
+		status if every equation is satisfied, NO_SOLUTIONS if one is
+		not, OVERFLOW on 32-bit Overflow.
+*/
+unsigned int eqsolver::verifySolution(struct fraction *solution, unsigned int status)
+{
+	unsigned int i, j;	/* i = row, j = column */
+	unsigned int first, last;	/* Band Columns Of Row */
+	struct fraction solutionCheck;
+	struct fraction expected;
+
+	for(i=0; i<eqCount; i++)
+	{
+		solutionCheck.numerator = 0;
+		solutionCheck.denominator = 0;
+		solutionCheck.sign = 0;
+		
+		/* Total Row */
+		if(originalCoefficient == NULL)	/* Compact, Band, Symmetric Or Structured Storage */
+		{
+			first = 0;
+			last = eqCount-1;
+			if(bandCoefficient != NULL)
+			{
+				first = (i > bandLower) ? (i-bandLower) : 0;
+				last = ((i+bandUpper) < eqCount) ? (i+bandUpper) : (eqCount-1);
+			}
+			for(j=first; j<=last; j++)
+			{
+				solutionCheck = add(solutionCheck, multiply(originalValue(i, j), solution[j]));
+				if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			}
+			expected = reduce(originalValue(i, eqCount));
+		}
+		else
+		{
+			for(j=0; j<eqCount; j++)
+			{
+				solutionCheck = add(solutionCheck, multiply(originalCoefficient[i][j], solution[j]));
+				if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			}
+			expected = reduce(originalCoefficient[i][eqCount]);
+		}
+
+		if((solutionCheck.numerator != expected.numerator) ||
+			(solutionCheck.denominator != expected.denominator) ||
+			(solutionCheck.sign != expected.sign))
+			return NO_SOLUTIONS;
+	}
+
+	return status;
+}
+
+/*	The purpose of this function is to subtract a multiple of one
+	matrix row from another over a range of columns.
+
+	Parameters: 
+		rowPtr - row to be altered
+		sourceRowPtr - row to subtract
+		multiplier - value by which sourceRowPtr is multiplied
+		firstColumn, lastColumn - columns to process (lastColumn excluded)
+
+	Returns:
+		Returns nothing. Check overFlow after calling.
+*/
+void eqsolver::subtractScaledRow(struct fraction *rowPtr, struct fraction *sourceRowPtr, struct fraction multiplier,
+								 unsigned int firstColumn, unsigned int lastColumn)
+{
+	unsigned int column;
+	struct fraction product;
+
+	/* Subtracting Is Adding The Negated Multiple */
+	if(multiplier.sign == 0)
+		multiplier.sign = 1;
+	else
+		multiplier.sign = 0;
+
+	for(column=firstColumn; column<lastColumn; column++)
+	{
+		if(sourceRowPtr[column].numerator == 0)
+			continue;	/* Nothing To Subtract */
+
+		product = multiply(sourceRowPtr[column], multiplier);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+		rowPtr[column] = add(rowPtr[column], product);
+		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+	}
+}
+
+/*	The purpose of this function is to finish the reduced row echelon
+	form of a singular system and describe its solutions. Gauss-Jordan
+	elimination has already reduced the columns left of "row" (rows
+	0..row-1 hold those pivots), so the elimination simply carries on
+	from there, skipping columns without a pivot.
+
+	Parameters: 
+		coeffPtr - working copy to operate on (altered)
+		row - number of pivots already found
+
+	Returns:
+		NO_SOLUTIONS if the system is inconsistent. Otherwise
+		INFINITE_SOLUTIONS, with pivotColumn/pivotCount, a particular
+		solution in solutionCoefficient (free unknowns set to 0) and
+		nullspaceBasis/nullity filled in. MEMORY_ERROR is returned on
+		allocation errors. Returns OVERFLOW on 32-bit Overflow.
+*/
+unsigned int eqsolver::finishReducedEchelon(struct fraction **coeffPtr, unsigned short int row)
+{
+	unsigned int i, j, column, pivotRow, freeColumn;
+	unsigned int status;
+	struct fraction multiplier;
+
+	/* Record Pivots Found So Far */
+	for(i=0; i<row; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = row;
+
+	for(column=row; (column<eqCount) && (pivotCount<eqCount); column++)
+	{
+		/* Locate Pivot At Or Below The Next Pivot Row */
+		for(pivotRow=pivotCount; pivotRow<eqCount; pivotRow++)
+			if(coeffPtr[pivotRow][column].numerator != 0)
+				break;
+
+		if(pivotRow == eqCount)
+			continue;	/* Free Column */
+
+		swapRows((pivotCount+1), (pivotRow+1), coeffPtr);
+
+		/* Is Pivot-Point = 1? If Not, Divide To Make It So */
+		if(!((coeffPtr[pivotCount][column].numerator == 1) && (coeffPtr[pivotCount][column].denominator == 1) && (coeffPtr[pivotCount][column].sign == 0)))
+		{
+			divideMatrixRow((pivotCount+1), coeffPtr[pivotCount][column], coeffPtr);
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		/* Clear Out Column Above & Below, Columns Left Of Pivot Are Zero */
+		for(i=0; i<eqCount; i++)
+		{
+			if((i == pivotCount) || (coeffPtr[i][column].numerator == 0))
+				continue;
+
+			multiplier = coeffPtr[i][column];
+			subtractScaledRow(coeffPtr[i], coeffPtr[pivotCount], multiplier, column, (eqCount+1));
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		pivotColumn[pivotCount] = (unsigned short int)(column+1);
+		pivotCount++;
+	}
+
+	/* Rows Without A Pivot Read 0 = RHS */
+	for(i=pivotCount; i<eqCount; i++)
+	{
+		if(coeffPtr[i][eqCount].numerator != 0)
+		{
+			pivotCount = 0;
+			return NO_SOLUTIONS;
+		}
+	}
+
+	/* Particular Solution, Free Unknowns Are 0 */
+	for(i=0; i<eqCount; i++)
+	{
+		solutionCoefficient[i].numerator = solutionCoefficient[i].denominator = 0;
+		solutionCoefficient[i].sign = 0;
+	}
+	for(i=0; i<pivotCount; i++)
+		solutionCoefficient[(pivotColumn[i]-1)] = coeffPtr[i][eqCount];
+
+	/* Nullspace Basis, One Vector Per Free Column */
+	nullity = (unsigned short int)(eqCount - pivotCount);
+	nullspaceBasis = (struct fraction **) allocateMemory(nullity * sizeof(struct fraction *));
+	if(nullspaceBasis == NULL)
+	{
+		releaseParametricSolution();
+		return MEMORY_ERROR;
+	}
+	for(i=0; i<nullity; i++)
+		nullspaceBasis[i] = NULL;
+
+	i = 0;	/* Index Into pivotColumn */
+	freeColumn = 0;	/* Index Into nullspaceBasis */
+	for(column=0; column<eqCount; column++)
+	{
+		if((i < pivotCount) && (pivotColumn[i] == (column+1)))
+		{
+			i++;
+			continue;
+		}
+
+		nullspaceBasis[freeColumn] = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+		if(nullspaceBasis[freeColumn] == NULL)
+		{
+			releaseParametricSolution();
+			return MEMORY_ERROR;
+		}
+
+		for(j=0; j<eqCount; j++)
+		{
+			nullspaceBasis[freeColumn][j].numerator = nullspaceBasis[freeColumn][j].denominator = 0;
+			nullspaceBasis[freeColumn][j].sign = 0;
+		}
+
+		/* Free Unknown = 1, Pivot Unknowns = -(Entry In Free Column) */
+		nullspaceBasis[freeColumn][column].numerator = nullspaceBasis[freeColumn][column].denominator = 1;
+		for(j=0; j<pivotCount; j++)
+		{
+			if(coeffPtr[j][column].numerator == 0)
+				continue;
+			nullspaceBasis[freeColumn][(pivotColumn[j]-1)] = coeffPtr[j][column];
+			nullspaceBasis[freeColumn][(pivotColumn[j]-1)].sign = (coeffPtr[j][column].sign == 1) ? 0 : 1;
+		}
+
+		freeColumn++;
+	}
+
+	status = verifySolution(solutionCoefficient, INFINITE_SOLUTIONS);
+	if(status != INFINITE_SOLUTIONS)
+		releaseParametricSolution();
+
+	return status;
+}
+
+/*	The purpose of this function is to choose the width of the tiles
+	tiledSolve() eliminates. In memory it is tileSize, so tiles stay in
+	cache. Out of core each step streams its panel of columns and the
+	matching panel of rows against the rest of the matrix, so panels
+	are made as wide as the memory budget allows (in whole tiles): one
+	pass over the tile file per panel, eqCount / width passes in all.
+
+	Parameters: 
+		None
+
+	Returns:
+		Rows & columns per tile.
+*/
+unsigned int eqsolver::eliminationTileSize(void)
+{
+	UINT64 width;
+
+	if(!arenaFileBacked)
+		return tileSize;
+
+	/* Panel Column & Panel Row, eqCount x width Fractions Each */
+	width = outOfCoreBudget / (2 * (UINT64)(eqCount+1) * sizeof(struct fraction));
+	width -= width % tileSize;
+	if(width < tileSize)
+		width = tileSize;
+	if(width > eqCount)
+		width = eqCount;
+
+	return (unsigned int) width;
+}
+
+/*	The purpose of this function is to allocate the rows of a matrix
+	and fill them, zeros or a copy of another matrix. When the tiled
+	elimination will run on several threads, each block of tileSize
+	rows is allocated and first written by the worker that will own
+	it (see runOwned()), so on NUMA machines the operating system
+	places it on that worker's node. Rows carved from a huge page
+	arena are placed the same way, the arena being untouched until
+	then.
+
+	Parameters: 
+		rows - eqCount row pointers (filled in, NULL where allocation
+				failed)
+		source - matrix to copy, NULL to zero-initialize
+		block - eqCount x (eqCount+1) fractions to carve the rows
+				from, NULL to malloc() each row
+
+	Returns:
+		1 on success, 0 on allocation errors.
+*/
+int eqsolver::placeRows(struct fraction **rows, struct fraction **source, struct fraction *block)
+{
+	struct placementWork work;
+
+	work.rows = rows;
+	work.source = source;
+	work.numerator = work.denominator = NULL;
+	work.block = block;
+
+	return runPlacement(work);
+}
+
+/*	The purpose of this function is to allocate the rows of a working
+	copy of the "original" matrix, as placeRows() does. Compact storage
+	is widened to fractions as the rows are filled.
+
+	Parameters: 
+		rows - eqCount row pointers (filled in, NULL where allocation
+				failed)
+		block - eqCount x (eqCount+1) fractions to carve the rows
+				from, NULL to malloc() each row
+
+	Returns:
+		1 on success, 0 on allocation errors.
+*/
+int eqsolver::placeOriginal(struct fraction **rows, struct fraction *block)
+{
+	struct placementWork work;
+
+	if(compactNumerator == NULL)
+		return placeRows(rows, originalCoefficient, block);
+
+	work.rows = rows;
+	work.source = NULL;
+	work.numerator = compactNumerator;
+	work.denominator = compactDenominator;
+	work.block = block;
+
+	return runPlacement(work);
+}
+
+/*	The purpose of this function is to run placeRowTask() over every
+	block of rows, by their owning workers when the tiled elimination
+	will run on several threads (see placeRows()).
+
+	Parameters: 
+		work - rows, source & block set up by the caller
+
+	Returns:
+		1 on success, 0 on allocation errors.
+*/
+int eqsolver::runPlacement(struct placementWork &work)
+{
+	unsigned int i, tiles;
+
+	work.count = eqCount;
+	work.tileSize = tileSize;
+	work.account = activeAccount();
+
+	for(i=0; i<eqCount; i++)
+		work.rows[i] = NULL;
+
+	tiles = (eqCount+tileSize-1) / tileSize;
+	if(tiledEnabled && (eqCount >= (2*tileSize)) && (threadCount != 1))
+		runOwned(activeAccount(), threadCount, tiles, placeRowTask, &work);
+	else
+		for(i=0; i<tiles; i++)
+			placeRowTask(&work, i);
+
+	for(i=0; i<eqCount; i++)
+		if(work.rows[i] == NULL)
+			return 0;
+
+	return 1;
+}
+
+/*	The purpose of this function is to allocate and fill one block of
+	rows for placeRows(). It is the task handed to runOwned().
+
+	Parameters: 
+		context - the placementWork
+		index - row block #
+
+	Returns:
+		None
+*/
+void eqsolver::placeRowTask(void *context, unsigned int index)
+{
+	struct placementWork *work = (struct placementWork *) context;
+	unsigned int row, last, column;
+
+	last = ((index+1) * work->tileSize < work->count) ? ((index+1) * work->tileSize) : work->count;
+	for(row=index*work->tileSize; row<last; row++)
+	{
+		if(work->block != NULL)
+			work->rows[row] = work->block + (UINT64) row * (work->count+1);
+		else
+			work->rows[row] = (struct fraction *) allocateFrom(work->account, (work->count+1) * sizeof(struct fraction));
+		if(work->rows[row] == NULL)
+			continue;	/* placeRows() Reports It */
+
+		for(column=0; column<=work->count; column++)
+		{
+			if(work->source != NULL)
+				work->rows[row][column] = work->source[row][column];
+			else if(work->numerator != NULL)
+				work->rows[row][column] = widenCompact(work->numerator, work->denominator, (UINT64) row * (work->count+1) + column);
+			else
+			{
+				work->rows[row][column].numerator = work->rows[row][column].denominator = 0;
+				work->rows[row][column].sign = 0;
+			}
+		}
+	}
+}
+
+/*	The purpose of this function is to deallocate a working matrix
+	of eqCount rows. Rows which were never allocated must be NULL,
+	rows in the huge page arena are left to cleanup().
+
+	Parameters: 
+		coeffPtr - matrix to deallocate (may be NULL)
+
+	Returns:
+		None
+*/
+void eqsolver::destroyMatrix(struct fraction **coeffPtr)
+{
+	unsigned int i;
+
+	if(coeffPtr == NULL)
+		return;
+
+	for(i=0; i<eqCount; i++)
+		if((coeffPtr[i] != NULL) && !arenaOwns(coeffPtr[i]))
+			releaseMemory(coeffPtr[i]);
+
+	releaseMemory(coeffPtr);
+}
+
+/*	The purpose of this function is to map the arena for a system of
+	count equations: the "original" matrix (unless held in compact
+	storage), the working copy of solveSystem() and the solution, each
+	one contiguous region (see ARENA_ORIGINAL ..). The altered matrix,
+	only set up for row operations, is malloc()ed.
+	It is backed by huge pages, so page table walks stay cheap however
+	far apart the rows of a pivot column are, or in out-of-core mode by
+	the tile file (see setOutOfCore()). cleanup() releases everything
+	as one unit.
+
+	Parameters: 
+		count - # of equations
+		original - 1 = lay out an ARENA_ORIGINAL region
+
+	Returns:
+		1 on success, 0 if the arena could not be mapped (matrices are
+		then allocated row by row as usual, unless out-of-core).
+*/
+int eqsolver::createArena(unsigned int count, int original)
+{
+	UINT64 size;
+
+	size = ((UINT64) (original ? 2 : 1) * count * (count+1) + count) * sizeof(struct fraction);
+	arenaOriginal = original;
+	arenaFileBacked = (outOfCorePath != NULL);
+	if(arenaFileBacked)
+		arena = (struct fraction *) mapArenaFile(outOfCorePath, size);
+	else
+		arena = (struct fraction *) mapArena(size);
+	if(arena == NULL)
+		return 0;
+
+	arenaSize = size;
+	arenaCount = count;
+
+	/* Memory Only, A Tile File Lives On Disk */
+	if(!arenaFileBacked)
+	{
+		lockAccount(activeAccount());
+		countMemory(activeAccount(), arenaSize, 1);
+		unlockAccount(activeAccount());
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to unmap the huge page arena, if
+	any, as one unit. Nothing may point into it afterwards.
+
+	Parameters: 
+		None
+
+	Returns:
+		None
+*/
+void eqsolver::releaseArena(void)
+{
+	if(arena == NULL)
+		return;
+
+	if(!arenaFileBacked)
+	{
+		lockAccount(activeAccount());
+		countMemory(activeAccount(), arenaSize, 0);
+		unlockAccount(activeAccount());
+	}
+
+	unmapArena(arena, arenaSize, arenaFileBacked);
+	arenaFileBacked = 0;
+	arenaOriginal = 1;
+	arena = NULL;
+	arenaSize = 0;
+	arenaCount = 0;
+}
+
+/*	The purpose of this function is to locate one region of the huge
+	page arena.
+
+	Parameters: 
+		region - ARENA_ORIGINAL, ARENA_WORKING or ARENA_SOLUTION
+
+	Returns:
+		Start of the region, NULL if there is no arena (or it was laid
+		out for fewer equations than eqCount, or without the region).
+*/
+struct fraction *eqsolver::arenaRegion(unsigned int region)
+{
+	if((arena == NULL) || (eqCount > arenaCount) || ((region == ARENA_ORIGINAL) && !arenaOriginal))
+		return NULL;
+
+	/* Without ARENA_ORIGINAL The Other Regions Move Up One */
+	if(!arenaOriginal)
+		region--;
+
+	return arena + (UINT64) region * arenaCount * (arenaCount+1);
+}
+
+/*	The purpose of this function is to tell whether memory lies in
+	the huge page arena, i.e. must not be passed to free().
+
+	Parameters: 
+		pointer - memory to check
+
+	Returns:
+		1 if it lies in the arena, else 0.
+*/
+int eqsolver::arenaOwns(void *pointer)
+{
+	if(arena == NULL)
+		return 0;
+
+	return ((char *) pointer >= (char *) arena) && ((char *) pointer < ((char *) arena + arenaSize));
+}
+
+/*	The purpose of this function is to move the matrices and solution
+	out of the huge page arena into malloc()ed storage and release the
+	arena, before storage is resized (arena rows cannot grow in place).
+	Nothing changes if an allocation fails.
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success (or without arena)
+		0 in case of an error (such as memory allocation errors)
+*/
+int eqsolver::leaveArena(void)
+{
+	struct fraction **original, *solution;
+	unsigned int i;
+
+	if(arena == NULL)
+		return 1;
+
+	original = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	solution = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+	if((original == NULL) || (solution == NULL))
+	{
+		if(original != NULL) releaseMemory(original);
+		if(solution != NULL) releaseMemory(solution);
+		return 0;
+	}
+
+	for(i=0; i<eqCount; i++)
+		original[i] = NULL;
+	if((originalCoefficient != NULL) && !placeRows(original, originalCoefficient, NULL))
+	{
+		destroyMatrix(original);
+		releaseMemory(solution);
+		return 0;
+	}
+	memcpy(solution, solutionCoefficient, eqCount * sizeof(struct fraction));
+
+	/* The Altered Matrix & Compact Storage Never Live In The Arena */
+	if(originalCoefficient != NULL)
+	{
+		destroyMatrix(originalCoefficient);	/* Widened From Compact Storage: malloc()ed */
+		originalCoefficient = original;
+	}
+	else
+		releaseMemory(original);
+	solutionCoefficient = solution;
+
+	releaseArena();
+
+	return 1;
+}
+
+/*	The purpose of this function is to find the memory account this
+	solver charges: its own, or that of the solver it solves a
+	subsystem for.
+
+	Parameters: 
+		None
+
+	Returns:
+		The account.
+*/
+struct memoryAccount *eqsolver::activeAccount(void)
+{
+	return (parentAccount != NULL) ? parentAccount : &ownAccount;
+}
+
+/*	The purpose of these functions is to allocate, resize and release
+	memory like malloc(), realloc() and free(), through the allocator
+	hook (see setAllocator()) and charged to activeAccount(). Every
+	buffer the solver allocates goes through them.
+*/
+void *eqsolver::allocateMemory(size_t size)
+{
+	return allocateFrom(activeAccount(), size);
+}
+
+void *eqsolver::reallocateMemory(void *pointer, size_t size)
+{
+	return reallocateFrom(activeAccount(), pointer, size);
+}
+
+void eqsolver::releaseMemory(void *pointer)
+{
+	releaseTo(activeAccount(), pointer);
+}
+
+/*	The purpose of this function is to discard the description of
+	an infinite solution set left by a previous solve.
+
+	Parameters: 
+		None
+
+	Returns:
+		None
+*/
+void eqsolver::releaseParametricSolution(void)
+{
+	unsigned int i;
+
+	if(nullspaceBasis != NULL)
+	{
+		for(i=0; i<nullity; i++)
+			if(nullspaceBasis[i] != NULL)
+				releaseMemory(nullspaceBasis[i]);
+		releaseMemory(nullspaceBasis);
+	}
+
+	nullspaceBasis = NULL;
+	nullity = 0;
+	pivotCount = 0;
+}
+
+/*	The purpose of this function is to compute the determinant of
+	the unaltered coefficient matrix (the RHS column is ignored). It
+	uses fraction-free elimination and skips the verification pass
+	solveSystem() performs, returning as soon as a column without a
+	pivot shows the matrix is singular.
+
+	Parameters: 
+		determinantValue - reference to fraction structure (stores result)
+
+	Returns:
+		SOLVED on success. MEMORY_ERROR is returned on allocation
+		errors. Returns OVERFLOW if an intermediate value or the
+		result does not fit.
+*/
+unsigned int eqsolver::determinant(struct fraction &determinantValue)
+{
+	INT64 **intPtr;
+	INT64 *rowScale;
+	INT64 numerator, denominator, scale, common;
+	unsigned int i, rowSwaps;
+	unsigned short int pivotCount;
+
+	if(!expandStorage())
+		return MEMORY_ERROR;	/* Needs Regular Storage */
+
+	overFlow = 0;	/* Reset Overflow Flag */
+
+	determinantValue.numerator = determinantValue.denominator = 0;
+	determinantValue.sign = 0;
+
+	/* Empty System, Empty Product */
+	if(eqCount == 0)
+	{
+		determinantValue.numerator = determinantValue.denominator = 1;
+		return SOLVED;
+	}
+
+	rowScale = (INT64 *) allocateMemory(eqCount * sizeof(INT64));
+	if(rowScale == NULL)
+		return MEMORY_ERROR;
+
+	intPtr = createIntegerMatrix(rowScale);
+	if(intPtr == NULL)
+	{
+		releaseMemory(rowScale);
+		return (overFlow) ? OVERFLOW : MEMORY_ERROR;
+	}
+
+	pivotCount = fractionFreeEliminate(intPtr, 1, rowSwaps);
+	numerator = intPtr[(eqCount-1)][(eqCount-1)];
+	destroyIntegerMatrix(intPtr);
+
+	if(overFlow)
+	{
+		releaseMemory(rowScale);
+		return OVERFLOW;
+	}
+
+	/* Rank Deficient, Determinant Is 0 (Stored As 0/0) */
+	if(pivotCount < eqCount)
+	{
+		releaseMemory(rowScale);
+		return SOLVED;
+	}
+
+	/* Undo Row Scaling, Reducing As We Go To Delay Overflow */
+	denominator = 1;
+	for(i=0; i<eqCount; i++)
+	{
+		scale = rowScale[i];
+		common = (INT64)gcd64((UINT64)((numerator < 0) ? -numerator : numerator), (UINT64)scale);
+		numerator = numerator / common;
+		scale = scale / common;
+		if(!multiply64(denominator, scale, denominator))
+		{
+			releaseMemory(rowScale);
+			return OVERFLOW;
+		}
+	}
+	releaseMemory(rowScale);
+
+	if(rowSwaps % 2)
+		numerator = -numerator;
+
+	if(numerator < 0)
+	{
+		determinantValue.sign = 1;
+		numerator = -numerator;
+	}
+
+	if((numerator > UINT32MAX) || (denominator > UINT32MAX))
+	{
+		overFlow = 1;	/* Set Overflow Flag */
+		determinantValue.sign = 0;
+		return OVERFLOW;
+	}
+
+	determinantValue.numerator = (unsigned int) numerator;
+	determinantValue.denominator = (unsigned int) denominator;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to compute the rank of the
+	unaltered coefficient matrix (the RHS column is ignored) using
+	fraction-free elimination. No verification pass is performed.
+
+	Parameters: 
+		rankValue - reference to storage for the rank
+
+	Returns:
+		SOLVED on success. MEMORY_ERROR is returned on allocation
+		errors. Returns OVERFLOW on 64-bit overflow.
+*/
+unsigned int eqsolver::rank(unsigned short int &rankValue)
+{
+	INT64 **intPtr;
+	INT64 *rowScale;
+	unsigned int rowSwaps;
+
+	if(!expandStorage())
+		return MEMORY_ERROR;	/* Needs Regular Storage */
+
+	overFlow = 0;	/* Reset Overflow Flag */
+	rankValue = 0;
+
+	if(eqCount == 0)
+		return SOLVED;
+
+	rowScale = (INT64 *) allocateMemory(eqCount * sizeof(INT64));
+	if(rowScale == NULL)
+		return MEMORY_ERROR;
+
+	intPtr = createIntegerMatrix(rowScale);
+	releaseMemory(rowScale);	/* Scaling Does Not Affect Rank */
+	if(intPtr == NULL)
+		return (overFlow) ? OVERFLOW : MEMORY_ERROR;
+
+	rankValue = fractionFreeEliminate(intPtr, 0, rowSwaps);
+	destroyIntegerMatrix(intPtr);
+
+	if(overFlow)
+	{
+		rankValue = 0;
+		return OVERFLOW;
+	}
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to absorb one more equation into
+	a system whose equations arrive one at a time. The altered matrix
+	is kept in reduced row echelon form: its first streamRank rows
+	hold the independent equations received so far, so each arrival
+	costs O(N * rank) instead of a full solveSystem(). Independent
+	equations are also copied into the "original" matrix (redundant
+	ones are dropped), so solveSystem() remains usable; after a
+	failure it returns the same status as addEquation(). The system
+	must have been dimensioned by setSystemEqCount() first, and the
+	public row operations on the altered matrix must not be used while
+	equations are being added.
+
+	Parameters: 
+		values - eqCount+1 coefficients, the RHS last
+
+	Returns:
+		SOLVED once the system is fully determined (solutionCoefficient
+		holds the solution), INFINITE_SOLUTIONS while it is not (pivotColumn
+		and pivotCount describe the equations so far), NO_SOLUTIONS once an
+		equation contradicts the others. NO_SOLUTIONS and OVERFLOW are
+		sticky until setSystemEqCount() is called again. MEMORY_ERROR is
+		returned on allocation errors.
+*/
+unsigned int eqsolver::addEquation(const short int *values)
+{
+	unsigned int column;
+
+	if(!expandStorage() || !prepareStream())
+		return MEMORY_ERROR;
+	if(streamStatus != 0)
+		return streamStatus;
+
+	for(column=0; column<=eqCount; column++)
+		streamScratch[column] = makeFraction(values[column], 1);
+	keepStreamEquation();
+
+	return absorbEquation();
+}
+
+/* Same As Above, Coefficients In Fraction Form */
+unsigned int eqsolver::addEquationFraction(const short int *numerators, const short int *denominators)
+{
+	unsigned int column;
+
+	if(!expandStorage() || !prepareStream())
+		return MEMORY_ERROR;
+	if(streamStatus != 0)
+		return streamStatus;
+
+	for(column=0; column<=eqCount; column++)
+		streamScratch[column] = makeFraction(numerators[column], denominators[column]);
+	keepStreamEquation();
+
+	return absorbEquation();
+}
+
+/*	The purpose of this function is to convert a 16-bit numerator &
+	denominator pair into a reduced fraction. A 0 denominator yields 0
+	(0/0), as in setCoefficientFraction().
+
+	Parameters: 
+		numerator, denominator - value to convert
+
+	Returns:
+		The fraction.
+*/
+struct fraction eqsolver::makeFraction(short int numerator, short int denominator)
+{
+	struct fraction result;
+
+	result.numerator = (unsigned int) abs((int)numerator);
+	result.denominator = (unsigned int) abs((int)denominator);
+	result.sign = ((numerator < 0) != (denominator < 0)) ? 1 : 0;
+
+	return reduce(result);
+}
+
+/*	The purpose of this function is to allocate the storage used to
+	absorb equations one at a time.
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+int eqsolver::prepareStream(void)
+{
+	if(!widenOriginal() || !prepareAltered())
+		return 0;	/* Equations Are Kept As Fractions, Echelon Form In coefficient */
+
+	if((coefficient == NULL) || (originalCoefficient == NULL))
+		return 0;	/* System Not Dimensioned */
+
+	if(streamPivot == NULL)
+		streamPivot = (unsigned short int *) allocateMemory(eqCount * sizeof(unsigned short int));
+	if(streamScratch == NULL)
+		streamScratch = (struct fraction *) allocateMemory((eqCount+1) * sizeof(struct fraction));
+
+	if((streamPivot == NULL) || (streamScratch == NULL))
+		return 0;
+
+	return 1;
+}
+
+/*	The purpose of this function is to copy the equation held in
+	streamScratch, as received, into the next free row of the
+	"original" matrix. Should the equation prove redundant the row
+	is simply reused by the next one.
+
+	Parameters: 
+		None
+
+	Returns:
+		None
+*/
+void eqsolver::keepStreamEquation(void)
+{
+	unsigned int column;
+
+	if(streamRank == eqCount)
+		return;	/* No Free Row, Equation Cannot Be Independent */
+
+	releaseFactorization();	/* Inverse No Longer Matches */
+
+	for(column=0; column<=eqCount; column++)
+		originalCoefficient[streamRank][column] = streamScratch[column];
+}
+
+/*	The purpose of this function is to reduce the equation held in
+	streamScratch against the echelon form and, if it is independent,
+	add it as a new pivot row.
+
+	Parameters: 
+		None
+
+	Returns:
+		Same as addEquation().
+*/
+unsigned int eqsolver::absorbEquation(void)
+{
+	unsigned int i, column, newPivot;
+	struct fraction multiplier;
+
+	overFlow = 0;	/* Reset Overflow Flag */
+
+	/* Remove Known Pivot Columns From The New Equation */
+	for(i=0; i<streamRank; i++)
+	{
+		multiplier = streamScratch[streamPivot[i]];
+		if(multiplier.numerator == 0)
+			continue;
+
+		subtractScaledRow(streamScratch, coefficient[i], multiplier, 0, (eqCount+1));
+		if(overFlow)
+		{
+			streamStatus = OVERFLOW;
+			return OVERFLOW;
+		}
+	}
+
+	/* Locate First Remaining Coefficient */
+	for(newPivot=0; newPivot<eqCount; newPivot++)
+		if(streamScratch[newPivot].numerator != 0)
+			break;
+
+	if(newPivot == eqCount)	/* Nothing New, Check It Agrees */
+	{
+		if(streamScratch[eqCount].numerator != 0)
+		{
+			streamStatus = NO_SOLUTIONS;
+			return NO_SOLUTIONS;
+		}
+	}
+	else
+	{
+		/* Make New Pivot 1 */
+		multiplier = streamScratch[newPivot];
+		for(column=newPivot; column<=eqCount; column++)
+		{
+			if(streamScratch[column].numerator == 0)
+				continue;
+			streamScratch[column] = divide(streamScratch[column], multiplier);
+		}
+
+		if(overFlow)
+		{
+			streamStatus = OVERFLOW;
+			return OVERFLOW;
+		}
+
+		/* Clear New Pivot Column From Existing Rows */
+		for(i=0; i<streamRank; i++)
+		{
+			multiplier = coefficient[i][newPivot];
+			if(multiplier.numerator == 0)
+				continue;
+
+			subtractScaledRow(coefficient[i], streamScratch, multiplier, 0, (eqCount+1));
+			if(overFlow)
+				break;
+		}
+
+		if(overFlow)
+		{
+			streamStatus = OVERFLOW;
+			return OVERFLOW;
+		}
+
+		/* Store The Reduced Row */
+		for(column=0; column<=eqCount; column++)
+			coefficient[streamRank][column] = streamScratch[column];
+
+		streamPivot[streamRank] = (unsigned short int) newPivot;
+		streamRank++;
+	}
+
+	/* Publish Pivot Columns */
+	for(i=0; i<streamRank; i++)
+		pivotColumn[i] = (unsigned short int)(streamPivot[i]+1);
+	pivotCount = (unsigned short int) streamRank;
+
+	if(streamRank < eqCount)
+		return INFINITE_SOLUTIONS;
+
+	/* Fully Determined, Each Row Reads x[pivot] = RHS */
+	for(i=0; i<eqCount; i++)
+		solutionCoefficient[streamPivot[i]] = coefficient[i][eqCount];
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to solve the system specified
+	in the "original" matrix coefficients like solveSystem(), but to
+	also keep the exact inverse of the coefficient matrix. The inverse
+	lets updateCoefficient() and updateRow() re-solve after a change in
+	O(N^2) instead of O(N^3). The inverse is obtained by running the
+	Gauss-Jordan elimination on [A | RHS | I].
+
+	Parameters: 
+		None
+
+	Returns:
+		Same as solveSystem(). The inverse is only kept when SOLVED is
+		returned; singular systems are handed to solveSystem().
+*/
+unsigned int eqsolver::factorSystem(void)
+{
+	unsigned int i, j, column, pivotRow, width;
+	unsigned int status;
+	struct fraction **workPtr;
+	struct fraction *temp;
+	struct fraction multiplier;
+
+	if(!expandStorage())
+		return MEMORY_ERROR;	/* Needs Regular Storage */
+
+	overFlow = 0;	/* Reset Overflow Flag */
+	releaseParametricSolution();
+	releaseFactorization();
+
+	if(streamStatus != 0)
+		return streamStatus;	/* addEquation() Failed */
+
+	width = (2*eqCount) + 1;	/* Coefficients, RHS, Identity */
+
+	workPtr = (struct fraction **) allocateMemory(eqCount * sizeof(struct fraction *));
+	if(workPtr == NULL)
+		return MEMORY_ERROR;
+
+	for(i=0; i<eqCount; i++)
+		workPtr[i] = NULL;
+
+	for(i=0; i<eqCount; i++)
+	{
+		workPtr[i] = (struct fraction *) allocateMemory(width * sizeof(struct fraction));
+		if(workPtr[i] == NULL)
+		{
+			destroyMatrix(workPtr);
+			return MEMORY_ERROR;
+		}
+
+		for(j=0; j<=eqCount; j++)
+			workPtr[i][j] = originalValue(i, j);
+		for(j=(eqCount+1); j<width; j++)
+		{
+			workPtr[i][j].numerator = workPtr[i][j].denominator = 0;
+			workPtr[i][j].sign = 0;
+		}
+		workPtr[i][(eqCount+1+i)].numerator = workPtr[i][(eqCount+1+i)].denominator = 1;
+	}
+
+	for(column=0; column<eqCount; column++)
+	{
+		/* Locate Pivot At Or Below Diagonal */
+		for(pivotRow=column; pivotRow<eqCount; pivotRow++)
+			if(workPtr[pivotRow][column].numerator != 0)
+				break;
+
+		if(pivotRow == eqCount)	/* Singular, No Inverse To Keep */
+		{
+			destroyMatrix(workPtr);
+			return solveSystem();
+		}
+
+		temp = workPtr[pivotRow];
+		workPtr[pivotRow] = workPtr[column];
+		workPtr[column] = temp;
+
+		/* Make Pivot 1 */
+		multiplier = workPtr[column][column];
+		for(j=column; j<width; j++)
+		{
+			if(workPtr[column][j].numerator == 0)
+				continue;
+			workPtr[column][j] = divide(workPtr[column][j], multiplier);
+		}
+
+		/* Clear Out Column Above & Below */
+		for(i=0; (i<eqCount) && !overFlow; i++)
+		{
+			if((i == column) || (workPtr[i][column].numerator == 0))
+				continue;
+
+			multiplier = workPtr[i][column];
+			subtractScaledRow(workPtr[i], workPtr[column], multiplier, column, width);
+		}
+
+		if(overFlow)
+		{
+			destroyMatrix(workPtr);
+			return OVERFLOW;
+		}
+	}
+
+	for(i=0; i<eqCount; i++)
+		solutionCoefficient[i] = workPtr[i][eqCount];
+
+	status = verifySolution(solutionCoefficient, SOLVED);
+	if(status != SOLVED)
+	{
+		destroyMatrix(workPtr);
+		return status;
+	}
+
+	for(i=0; i<eqCount; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = eqCount;
+
+	/* Keep Only The Inverse, Shrinking Each Row In Place */
+	for(i=0; i<eqCount; i++)
+	{
+		memmove(workPtr[i], &workPtr[i][(eqCount+1)], eqCount * sizeof(struct fraction));
+		temp = (struct fraction *) reallocateMemory(workPtr[i], eqCount * sizeof(struct fraction));
+		if(temp != NULL)
+			workPtr[i] = temp;
+	}
+
+	inverseCoefficient = workPtr;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to change one coefficient of a
+	factored system and update its solution. A single coefficient is a
+	rank-1 change, so the Sherman-Morrison formula updates the inverse
+	in O(N^2) (the solution in O(N)). A change of the RHS only costs
+	O(N). If no factorization is held (for example after solveSystem()
+	or setCoefficient()), or the change makes the matrix singular, the
+	system is factored again from scratch.
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		column - matrix column # (starting at 1, eqCount+1 is the RHS)
+		value - new value of the coefficient
+
+	Returns:
+		Same as factorSystem(). In case of error (out of bound matrix
+		positioning), the function returns MEMORY_ERROR without
+		altering any memory.
+*/
+unsigned int eqsolver::updateCoefficient(unsigned short int row, unsigned short int column, short int value)
+{
+	unsigned int i;
+	struct fraction newValue;
+
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (column > (eqCount+1)) || (row < 1) || (column < 1))
+		return MEMORY_ERROR;
+
+	if(!expandStorage() || !prepareUpdate())
+		return MEMORY_ERROR;
+
+	/* Only One Entry Of The Change Is Nonzero */
+	for(i=0; i<=eqCount; i++)
+	{
+		updateDelta[i].numerator = updateDelta[i].denominator = 0;
+		updateDelta[i].sign = 0;
+	}
+
+	newValue = makeFraction(value, 1);
+	updateDelta[(column-1)] = subtract(newValue, originalCoefficient[(row-1)][(column-1)]);
+
+	originalCoefficient[(row-1)][(column-1)] = newValue;
+	if(coefficient != NULL)
+		coefficient[(row-1)][(column-1)] = newValue;
+
+	return applyRowUpdate((unsigned short int)(row-1));
+}
+
+/*	The purpose of this function is to replace one equation of a
+	factored system and update its solution. Replacing a row is a
+	rank-1 change, see updateCoefficient().
+
+	Parameters: 
+		row - matrix row # (starting at 1)
+		values - eqCount+1 new coefficients, the RHS last
+
+	Returns:
+		Same as updateCoefficient().
+*/
+unsigned int eqsolver::updateRow(unsigned short int row, const short int *values)
+{
+	unsigned int column;
+	struct fraction newValue;
+
+	/* Verify Matrix Bounds */
+	if((row > eqCount) || (row < 1))
+		return MEMORY_ERROR;
+
+	if(!expandStorage() || !prepareUpdate())
+		return MEMORY_ERROR;
+
+	for(column=0; column<=eqCount; column++)
+	{
+		newValue = makeFraction(values[column], 1);
+		updateDelta[column] = subtract(newValue, originalCoefficient[(row-1)][column]);
+		originalCoefficient[(row-1)][column] = newValue;
+		if(coefficient != NULL)
+			coefficient[(row-1)][column] = newValue;
+	}
+
+	return applyRowUpdate((unsigned short int)(row-1));
+}
+
+/*	The purpose of this function is to apply the Sherman-Morrison
+	formula for A' = A + e(row) * d, where d (and the RHS change) is
+	held in updateDelta. With w = column "row" of the inverse and
+	z = d * inverse:
+		inverse' = inverse - w * z / (1 + z[row])
+		solution' = solution - w * (d * solution - RHS change) / (1 + z[row])
+	"original" is already updated, so on failure it can be refactored.
+
+	Parameters: 
+		row - changed row # (starting at 0)
+
+	Returns:
+		Same as factorSystem().
+*/
+unsigned int eqsolver::applyRowUpdate(unsigned short int row)
+{
+	unsigned int i, j, k;
+	struct fraction denominator, dotProduct, scale;
+	struct fraction *w, *z;
+
+	if(inverseCoefficient == NULL)	/* Nothing To Update, Start Over */
+		return factorSystem();
+
+	overFlow = 0;	/* Reset Overflow Flag */
+	releaseParametricSolution();
+
+	w = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+	z = (struct fraction *) allocateMemory(eqCount * sizeof(struct fraction));
+	if((w == NULL) || (z == NULL))
+	{
+		if(w != NULL) releaseMemory(w);
+		if(z != NULL) releaseMemory(z);
+		return factorSystem();
+	}
+
+	/* w = Column "row" Of Inverse, z = d * Inverse */
+	for(j=0; j<eqCount; j++)
+	{
+		w[j] = inverseCoefficient[j][row];
+		z[j].numerator = z[j].denominator = 0;
+		z[j].sign = 0;
+	}
+	for(k=0; (k<eqCount) && !overFlow; k++)
+	{
+		if(updateDelta[k].numerator == 0)
+			continue;
+		for(j=0; (j<eqCount) && !overFlow; j++)
+		{
+			if(inverseCoefficient[k][j].numerator == 0)
+				continue;
+			z[j] = add(z[j], multiply(updateDelta[k], inverseCoefficient[k][j]));
+		}
+	}
+
+	/* 1 + z[row] = 0 Means The New Matrix Is Singular */
+	denominator.numerator = denominator.denominator = 1;
+	denominator.sign = 0;
+	denominator = add(denominator, z[row]);
+
+	if(overFlow || (denominator.numerator == 0))
+	{
+		releaseMemory(w);
+		releaseMemory(z);
+		return factorSystem();
+	}
+
+	/* Solution Update (Uses The Old Solution) */
+	dotProduct.numerator = dotProduct.denominator = 0;
+	dotProduct.sign = 0;
+	for(k=0; (k<eqCount) && !overFlow; k++)
+		if(updateDelta[k].numerator != 0)
+			dotProduct = add(dotProduct, multiply(updateDelta[k], solutionCoefficient[k]));
+	dotProduct = subtract(dotProduct, updateDelta[eqCount]);
+	scale = divide(dotProduct, denominator);
+
+	if(scale.numerator != 0)
+		for(i=0; (i<eqCount) && !overFlow; i++)
+			if(w[i].numerator != 0)
+				solutionCoefficient[i] = subtract(solutionCoefficient[i], multiply(w[i], scale));
+
+	/* Inverse Update, z Scaled Once So Each Entry Costs One Product */
+	for(j=0; (j<eqCount) && !overFlow; j++)
+		if(z[j].numerator != 0)
+			z[j] = divide(z[j], denominator);
+	for(i=0; (i<eqCount) && !overFlow; i++)
+	{
+		if(w[i].numerator == 0)
+			continue;
+		subtractScaledRow(inverseCoefficient[i], z, w[i], 0, eqCount);
+	}
+
+	releaseMemory(w);
+	releaseMemory(z);
+
+	if(overFlow)	/* Inverse Is Damaged, Start Over */
+		return factorSystem();
+
+	for(i=0; i<eqCount; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = eqCount;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to subtract two "fraction" values
+	(fraction1 - fraction2) and return the result to the caller.
+
+	Parameters: 
+		fraction1 - fraction to subtract from
+		fraction2 - fraction to subtract
+
+	Returns:
+		The result of the calculation is returned. Check overFlow
+		after calling.
+*/
+struct fraction eqsolver::subtract(struct fraction fraction1, struct fraction fraction2)
+{
+	if(fraction2.numerator == 0)
+		return fraction1;
+
+	fraction2.sign = (fraction2.sign == 1) ? 0 : 1;
+
+	return add(fraction1, fraction2);
+}
+
+/*	The purpose of this function is to allocate the storage holding
+	the change applied by updateCoefficient() and updateRow().
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+int eqsolver::prepareUpdate(void)
+{
+	if(!widenOriginal())
+		return 0;	/* Updates Change originalCoefficient In Place */
+
+	if(originalCoefficient == NULL)
+		return 0;	/* System Not Dimensioned */
+
+	if(updateDelta == NULL)
+		updateDelta = (struct fraction *) allocateMemory((eqCount+1) * sizeof(struct fraction));
+
+	return (updateDelta != NULL) ? 1 : 0;
+}
+
+/*	The purpose of this function is to discard the inverse kept by
+	factorSystem(). Called whenever the "original" matrix changes
+	behind the factorization's back.
+
+	Parameters: 
+		None
+
+	Returns:
+		None
+*/
+void eqsolver::releaseFactorization(void)
+{
+	if(inverseCoefficient != NULL)
+		destroyMatrix(inverseCoefficient);
+
+	inverseCoefficient = NULL;
+}
+
+/*	The purpose of this function is to add one equation and one
+	unknown to the system. The new unknown becomes the last one (its
+	column is inserted before the RHS) and the new equation the last
+	row. If the system is factored (see factorSystem()) the inverse and
+	solution are updated with the bordering formulas in O(N^2): with
+	A' = [A u; v d], Au = inverse * u, z = v * inverse and the Schur
+	complement s = d - v * Au,
+		inverse' = [inverse + Au * z / s, -Au / s; -z / s, 1 / s]
+		solution' = [solution - Au * y, y], y = (b - v * solution) / s
+	Otherwise, or if s = 0, the grown system is factored again.
+
+	Parameters: 
+		rowValues - eqCount+2 coefficients of the new equation (the
+					new unknown's coefficient next to last, the RHS last)
+		columnValues - eqCount coefficients of the new unknown in the
+					existing equations
+
+	Returns:
+		Same as factorSystem(). MEMORY_ERROR is also returned if the
+		system cannot grow (65535 equations already).
+*/
+unsigned int eqsolver::appendEquation(const short int *rowValues, const short int *columnValues)
+{
+	unsigned int i, j, n;
+	struct fraction *product, *z;
+	struct fraction schur, newUnknown, multiplier;
+
+	if(!expandStorage() || !widenOriginal() || (originalCoefficient == NULL) || (eqCount == 65535))
+		return MEMORY_ERROR;
+
+	n = eqCount;
+
+	if(!growSystem())
+		return MEMORY_ERROR;
+
+	/* Move RHS Right, Insert New Unknown's Column */
+	for(i=0; i<n; i++)
+	{
+		originalCoefficient[i][(n+1)] = originalCoefficient[i][n];
+		originalCoefficient[i][n] = makeFraction(columnValues[i], 1);
+		if(coefficient != NULL)
+		{
+			coefficient[i][(n+1)] = coefficient[i][n];
+			coefficient[i][n] = originalCoefficient[i][n];
+		}
+	}
+
+	/* New Equation */
+	for(j=0; j<=(n+1); j++)
+	{
+		originalCoefficient[n][j] = makeFraction(rowValues[j], 1);
+		if(coefficient != NULL)
+			coefficient[n][j] = originalCoefficient[n][j];
+	}
+
+	eqCount = (unsigned short int)(n+1);
+
+	if(inverseCoefficient == NULL)
+		return factorSystem();
+
+	overFlow = 0;	/* Reset Overflow Flag */
+	releaseParametricSolution();
+
+	product = (struct fraction *) allocateMemory(n * sizeof(struct fraction));
+	z = (struct fraction *) allocateMemory(n * sizeof(struct fraction));
+	if((product == NULL) || (z == NULL))
+	{
+		if(product != NULL) releaseMemory(product);
+		if(z != NULL) releaseMemory(z);
+		releaseFactorization();
+		return factorSystem();
+	}
+
+	/* product = inverse * u, z = v * inverse */
+	for(i=0; i<n; i++)
+	{
+		product[i].numerator = product[i].denominator = 0;
+		product[i].sign = 0;
+		z[i] = product[i];
+	}
+	for(i=0; (i<n) && !overFlow; i++)
+	{
+		for(j=0; (j<n) && !overFlow; j++)
+		{
+			if(inverseCoefficient[i][j].numerator == 0)
+				continue;
+			if(originalCoefficient[j][n].numerator != 0)
+				product[i] = add(product[i], multiply(inverseCoefficient[i][j], originalCoefficient[j][n]));
+			if(originalCoefficient[n][i].numerator != 0)
+				z[j] = add(z[j], multiply(originalCoefficient[n][i], inverseCoefficient[i][j]));
+		}
+	}
+
+	/* Schur Complement s = d - v * product, New Unknown = (b - v * x) / s */
+	schur = originalCoefficient[n][n];
+	newUnknown = originalCoefficient[n][(n+1)];
+	for(i=0; (i<n) && !overFlow; i++)
+	{
+		if(originalCoefficient[n][i].numerator == 0)
+			continue;
+		schur = subtract(schur, multiply(originalCoefficient[n][i], product[i]));
+		newUnknown = subtract(newUnknown, multiply(originalCoefficient[n][i], solutionCoefficient[i]));
+	}
+
+	if(overFlow || (schur.numerator == 0))	/* Grown Matrix Singular Or Overflow */
+	{
+		releaseMemory(product);
+		releaseMemory(z);
+		releaseFactorization();
+		return factorSystem();
+	}
+
+	newUnknown = divide(newUnknown, schur);
+
+	/* x' = x - product * newUnknown */
+	for(i=0; (i<n) && !overFlow; i++)
+		if(product[i].numerator != 0)
+			solutionCoefficient[i] = subtract(solutionCoefficient[i], multiply(product[i], newUnknown));
+	solutionCoefficient[n] = newUnknown;
+
+	/* Scale z By 1 / s Once */
+	for(i=0; (i<n) && !overFlow; i++)
+		if(z[i].numerator != 0)
+			z[i] = divide(z[i], schur);
+
+	/* Border The Inverse */
+	for(i=0; (i<n) && !overFlow; i++)
+	{
+		if(product[i].numerator == 0)
+		{
+			inverseCoefficient[i][n] = product[i];
+		}
+		else
+		{
+			multiplier = product[i];
+			multiplier.sign = (multiplier.sign == 1) ? 0 : 1;
+			subtractScaledRow(inverseCoefficient[i], z, multiplier, 0, n);
+			inverseCoefficient[i][n] = divide(multiplier, schur);
+		}
+
+		inverseCoefficient[n][i] = z[i];
+		if(z[i].numerator != 0)
+			inverseCoefficient[n][i].sign = (z[i].sign == 1) ? 0 : 1;
+	}
+	inverseCoefficient[n][n].numerator = schur.denominator;
+	inverseCoefficient[n][n].denominator = schur.numerator;
+	inverseCoefficient[n][n].sign = schur.sign;
+
+	releaseMemory(product);
+	releaseMemory(z);
+
+	if(overFlow)	/* Inverse Is Damaged, Start Over */
+	{
+		releaseFactorization();
+		return factorSystem();
+	}
+
+	for(i=0; i<eqCount; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = eqCount;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to remove one equation and one
+	unknown from the system. If the system is factored the inverse and
+	solution are updated in O(N^2) without refactoring: with h the
+	inverse entry at [column, row], f the inverse's column "row" and g
+	its row "column",
+		inverse' = inverse - f * g / h	(minus row "column" & column "row")
+		solution' = solution - f * solution[column] / h
+	Otherwise, or if h = 0 (the smaller matrix is singular), the
+	shrunk system is factored again.
+
+	Parameters: 
+		row - matrix row # of the equation to remove (starting at 1)
+		column - matrix column # of the unknown to remove (starting at 1)
+
+	Returns:
+		Same as factorSystem(). In case of error (out of bound matrix
+		positioning), the function returns MEMORY_ERROR without
+		altering any memory.
+*/
+unsigned int eqsolver::removeEquation(unsigned short int row, unsigned short int column)
+{
+	unsigned int i, r, c;
+	struct fraction pivot, multiplier;
+	int bordered;
+
+	/* Verify Matrix Bounds */
+	if(!expandStorage() || !widenOriginal() || (originalCoefficient == NULL) || (row > eqCount) || (column > eqCount) || (row < 1) || (column < 1))
+		return MEMORY_ERROR;
+
+	r = row-1;
+	c = column-1;
+
+	overFlow = 0;	/* Reset Overflow Flag */
+	releaseParametricSolution();
+	bordered = 0;
+
+	if(inverseCoefficient != NULL)
+	{
+		pivot = inverseCoefficient[c][r];
+
+		if(pivot.numerator != 0)
+		{
+			/* Rows Other Than "column" Lose f[i] / h Times Row "column" */
+			for(i=0; (i<eqCount) && !overFlow; i++)
+			{
+				if((i == c) || (inverseCoefficient[i][r].numerator == 0))
+					continue;
+
+				multiplier = divide(inverseCoefficient[i][r], pivot);
+				solutionCoefficient[i] = subtract(solutionCoefficient[i], multiply(multiplier, solutionCoefficient[c]));
+				subtractScaledRow(inverseCoefficient[i], inverseCoefficient[c], multiplier, 0, eqCount);
+			}
+
+			bordered = !overFlow;
+		}
+	}
+
+	shrinkSystem(r, c);
+
+	if(!bordered)
+	{
+		releaseFactorization();
+		return factorSystem();
+	}
+
+	for(i=0; i<eqCount; i++)
+		pivotColumn[i] = (unsigned short int)(i+1);
+	pivotCount = eqCount;
+
+	return SOLVED;
+}
+
+/*	The purpose of this function is to enlarge all storage which
+	depends on eqCount for one more equation & unknown, before
+	appendEquation() fills it in. eqCount itself is not changed.
+	Nothing is moved, so if an allocation fails the system is left
+	as it was (with some storage merely larger than needed).
+
+	Parameters: 
+		None
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+int eqsolver::growSystem(void)
+{
+	unsigned int i, n;
+	void *temp;
+
+	n = eqCount;
+
+	/* Arena Rows Cannot Grow In Place */
+	if(!leaveArena())
+		return 0;
+
+	/* Row Pointer Arrays & Per-Unknown Arrays (The Altered Matrix Only
+		Once Set Up) */
+	if(coefficient != NULL)
+	{
+		temp = reallocateMemory(coefficient, (n+1) * sizeof(struct fraction *));
+		if(temp == NULL) return 0;
+		coefficient = (struct fraction **) temp;
+	}
+
+	temp = reallocateMemory(originalCoefficient, (n+1) * sizeof(struct fraction *));
+	if(temp == NULL) return 0;
+	originalCoefficient = (struct fraction **) temp;
+
+	temp = reallocateMemory(solutionCoefficient, (n+1) * sizeof(struct fraction));
+	if(temp == NULL) return 0;
+	solutionCoefficient = (struct fraction *) temp;
+
+	temp = reallocateMemory(pivotColumn, (n+1) * sizeof(unsigned short int));
+	if(temp == NULL) return 0;
+	pivotColumn = (unsigned short int *) temp;
+
+	/* Existing Rows Gain A Column */
+	for(i=0; i<n; i++)
+	{
+		if(coefficient != NULL)
+		{
+			temp = reallocateMemory(coefficient[i], (n+2) * sizeof(struct fraction));
+			if(temp == NULL) return 0;
+			coefficient[i] = (struct fraction *) temp;
+		}
+
+		temp = reallocateMemory(originalCoefficient[i], (n+2) * sizeof(struct fraction));
+		if(temp == NULL) return 0;
+		originalCoefficient[i] = (struct fraction *) temp;
+	}
+
+	/* New Row */
+	originalCoefficient[n] = (struct fraction *) allocateMemory((n+2) * sizeof(struct fraction));
+	if(originalCoefficient[n] == NULL)
+		return 0;
+	if(coefficient != NULL)
+	{
+		coefficient[n] = (struct fraction *) allocateMemory((n+2) * sizeof(struct fraction));
+		if(coefficient[n] == NULL)
+		{
+			releaseMemory(originalCoefficient[n]);
+			return 0;
+		}
+	}
+
+	/* Inverse Gains A Row & Column, Dropped If That Fails */
+	if(inverseCoefficient != NULL)
+	{
+		temp = reallocateMemory(inverseCoefficient, (n+1) * sizeof(struct fraction *));
+		if(temp == NULL)
+			releaseFactorization();
+		else
+		{
+			inverseCoefficient = (struct fraction **) temp;
+			inverseCoefficient[n] = (struct fraction *) allocateMemory((n+1) * sizeof(struct fraction));
+
+			for(i=0; (inverseCoefficient[n] != NULL) && (i<n); i++)
+			{
+				temp = reallocateMemory(inverseCoefficient[i], (n+1) * sizeof(struct fraction));
+				if(temp == NULL)
+					break;
+				inverseCoefficient[i] = (struct fraction *) temp;
+			}
+
+			if((inverseCoefficient[n] == NULL) || (i < n))
+			{
+				if(inverseCoefficient[n] != NULL)
+					releaseMemory(inverseCoefficient[n]);
+				releaseFactorization();	/* Frees The First n Rows */
+			}
+		}
+	}
+
+	/* Dimension Changed, Drop Per-Dimension Scratch Storage */
+	releaseScratch();
+
+	return 1;
+}
+
+/*	The purpose of this function is to remove one equation (row) and
+	one unknown (column) from all storage which depends on eqCount,
+	decrementing eqCount.
+
+	Parameters: 
+		row - row to remove (starting at 0)
+		column - column to remove (starting at 0)
+
+	Returns:
+		None
+*/
+void eqsolver::shrinkSystem(unsigned int row, unsigned int column)
+{
+	unsigned int i, n;
+
+	n = eqCount;
+
+	/* Drop Row, Arena Rows Stay Until cleanup() */
+	if(coefficient != NULL)
+	{
+		releaseMemory(coefficient[row]);	/* Never In The Arena */
+		for(i=row; i<(n-1); i++)
+			coefficient[i] = coefficient[(i+1)];
+	}
+	if(!arenaOwns(originalCoefficient[row])) releaseMemory(originalCoefficient[row]);
+	for(i=row; i<(n-1); i++)
+		originalCoefficient[i] = originalCoefficient[(i+1)];
+
+	/* Drop Column, RHS Moves Left With The Rest */
+	for(i=0; i<(n-1); i++)
+	{
+		if(coefficient != NULL)
+			memmove(&coefficient[i][column], &coefficient[i][(column+1)], (n-column) * sizeof(struct fraction));
+		memmove(&originalCoefficient[i][column], &originalCoefficient[i][(column+1)], (n-column) * sizeof(struct fraction));
+	}
+
+	/* Drop Unknown From Solution */
+	memmove(&solutionCoefficient[column], &solutionCoefficient[(column+1)], (n-1-column) * sizeof(struct fraction));
+
+	/* Inverse Rows Follow Unknowns, Its Columns Follow Equations */
+	if(inverseCoefficient != NULL)
+	{
+		releaseMemory(inverseCoefficient[column]);
+		for(i=column; i<(n-1); i++)
+			inverseCoefficient[i] = inverseCoefficient[(i+1)];
+		for(i=0; i<(n-1); i++)
+			memmove(&inverseCoefficient[i][row], &inverseCoefficient[i][(row+1)], (n-1-row) * sizeof(struct fraction));
+	}
+
+	eqCount = (unsigned short int)(n-1);
+
+	releaseScratch();
+}
+
+/*	The purpose of this function is to deallocate scratch storage
+	sized by eqCount (updateDelta and the storage used to absorb
+	equations) when the dimension changes. Absorbing equations starts
+	over afterwards.
+
+	Parameters: 
+		None
+
+	Returns:
+		None
+*/
+void eqsolver::releaseScratch(void)
+{
+	if(updateDelta != NULL)
+		releaseMemory(updateDelta);
+	if(streamPivot != NULL)
+		releaseMemory(streamPivot);
+	if(streamScratch != NULL)
+		releaseMemory(streamScratch);
+
+	updateDelta = NULL;
+	streamPivot = NULL;
+	streamScratch = NULL;
+	streamRank = 0;
+	streamStatus = 0;
+}
+
+/*	The purpose of this function is to dimension a sparse system:
+	count equations in as many unknowns, of which only the nonzero
+	coefficients are stored (see setSparseCoefficient()). Rows &
+	columns are indexed by size_t, so the system may be far larger than
+	the 65535 equations of setSystemEqCount(), whose dense storage is
+	kept for the systems that fit it. The sparse system is independent
+	of the one set up by setSystemEqCount() and is solved by
+	solveSparse(). A sparse system set up before is discarded.
+
+	Parameters: 
+		count - number of equations (and unknowns)
+
+	Returns:
+		1 on success
+		0 in case of an error (such as memory allocation errors)
+*/
+unsigned int eqsolver::setSparseSystem(size_t count)
+{
+	size_t i;
+
+	releaseSparse();
+
+	/* No Need To Allocate Space, Empty System */
+	if(count == 0)
+		return 1;
+
+	if(count > (((size_t) -1) / sizeof(struct sparseRow)))
+		return 0;	/* Size Wraps Around */
+
+	sparseCoefficient = (struct sparseRow *) allocateMemory(count * sizeof(struct sparseRow));
+	sparseSolution = (struct fraction *) allocateMemory(count * sizeof(struct fraction));
+	if((sparseCoefficient == NULL) || (sparseSolution == NULL))
+	{
+		releaseSparse();
+		return 0;
+	}
+
+	/* Every Equation Starts Out Empty: 0 = 0 */
+	for(i=0; i<count; i++)
+	{
+		sparseCoefficient[i].entry = NULL;
+		sparseCoefficient[i].count = sparseCoefficient[i].capacity = 0;
+		sparseCoefficient[i].rhs.numerator = sparseCoefficient[i].rhs.denominator = 0;
+		sparseCoefficient[i].rhs.sign = 0;
+		sparseSolution[i] = sparseCoefficient[i].rhs;
+	}
+	sparseCount = count;
+
+	return 1;
+}
+
+/*	The purpose of this function is to set a coefficient of the sparse
+	system set up by setSparseSystem(). The value is reduced and held
+	as a fraction, as by setCoefficientFraction64(); setting a
+	coefficient to 0 removes it from storage. Coefficients are kept in
+	column order, so setting each row left to right is fastest.
+
+	Parameters: 
+		row - equation # (starting at 1)
+		column - unknown # (starting at 1), count+1 for the RHS
+		numerator - value at which to set the coefficient numerator
+		denominator - value at which to set the coefficient denominator
+
+	Returns:
+		1 on success
+		0 in case of an error (out of bound positioning, a reduced
+		numerator or denominator above 4294967295, memory allocation
+		errors), nothing is changed then
+*/
+unsigned int eqsolver::setSparseCoefficient(size_t row, size_t column, INT64 numerator, INT64 denominator)
+{
+	struct sparseRow *rowPtr;
+	struct fraction value;
+	size_t position;
+	int found;
+
+	/* Verify Bounds */
+	if((row < 1) || (row > sparseCount) || (column < 1) || (column > (sparseCount+1)))
+		return 0;
+
+	if(!reduceRational(numerator, denominator, value))
+		return 0;	/* Too Large For A Fraction */
+
+	rowPtr = &sparseCoefficient[(row-1)];
+	if(column == (sparseCount+1))
+	{
+		rowPtr->rhs = value;
+		return 1;
+	}
+
+	position = findSparseColumn(*rowPtr, (column-1));
+	found = (position < rowPtr->count) && (rowPtr->entry[position].column == (column-1));
+
+	/* Zeros Are Not Stored */
+	if(value.numerator == 0)
+	{
+		if(found)
+		{
+			memmove(&rowPtr->entry[position], &rowPtr->entry[(position+1)], (rowPtr->count-position-1) * sizeof(struct sparseEntry));
+			rowPtr->count--;
+		}
+		return 1;
+	}
+
+	if(found)
+	{
+		rowPtr->entry[position].value = value;
+		return 1;
+	}
+
+	if(!reserveSparseRow(*rowPtr, (rowPtr->count+1)))
+		return 0;
+
+	memmove(&rowPtr->entry[(position+1)], &rowPtr->entry[position], (rowPtr->count-position) * sizeof(struct sparseEntry));
+	rowPtr->entry[position].column = column-1;
+	rowPtr->entry[position].value = value;
+	rowPtr->count++;
+
+	return 1;
+}
+
+/*	The purpose of this function is to solve the sparse system set up
+	by setSparseSystem(). Gaussian elimination runs on a sparse working
+	copy: each step pivots on the active equation with the fewest
+	nonzeros, in its unknown held by the fewest other active equations
+	(a Markowitz-style choice keeping fill-in low), then eliminates that
+	unknown from the equations holding it. Back substitution follows &
+	the solution is checked against the system as set. Work & memory
+	grow with the nonzeros & fill-in, not with count squared.
+
+	Parameters: 
+		None
+
+	Returns:
+		SOLVED if a unique solution is found (sparseSolution holds it).
+		INFINITE_SOLUTIONS if the system is consistent but singular:
+		sparseSolution then holds the solution whose unknowns without a
+		pivot are 0. NO_SOLUTIONS if the equations contradict each
+		other. MEMORY_ERROR on allocation errors, OVERFLOW on 32-bit
+		overflow. sparseRank receives the number of pivots found.
+*/
+unsigned int eqsolver::solveSparse(void)
+{
+	struct sparseWork work;
+	unsigned int status;
+	size_t i;
+
+	overFlow = 0;	/* Reset Overflow Flag */
+	sparseRank = 0;
+
+	for(i=0; i<sparseCount; i++)
+	{
+		sparseSolution[i].numerator = sparseSolution[i].denominator = 0;
+		sparseSolution[i].sign = 0;
+	}
+
+	if(sparseCount == 0)
+		return SOLVED;	/* Empty System */
+
+	if(!createSparseWork(work))
+	{
+		releaseSparseWork(work);
+		return MEMORY_ERROR;
+	}
+
+	status = eliminateSparse(work);
+	if((status == SOLVED) || (status == INFINITE_SOLUTIONS))
+		status = substituteSparse(work, status);
+	releaseSparseWork(work);
+
+	if((status == SOLVED) || (status == INFINITE_SOLUTIONS))
+		status = verifySparse(status);
+
+	/* No Solution To Report */
+	if((status != SOLVED) && (status != INFINITE_SOLUTIONS))
+		for(i=0; i<sparseCount; i++)
+		{
+			sparseSolution[i].numerator = sparseSolution[i].denominator = 0;
+			sparseSolution[i].sign = 0;
 		}
 
-		overflowCheckWithSign = num2OverflowCheckWithSign * fraction1.denominator;
-		if((overflowCheckWithSign > INT32MAX) || (overflowCheckWithSign < INT32MIN))
+	return status;
+}
+
+/*	The purpose of this function is to allocate the workspace of
+	solveSparse() and fill it with a copy of the sparse system. Every
+	pointer is set (NULL if not allocated) before anything can fail,
+	so releaseSparseWork() may always be called.
+
+	Parameters: 
+		work - workspace to set up
+
+	Returns:
+		1 on success, 0 on memory allocation errors.
+*/
+int eqsolver::createSparseWork(struct sparseWork &work)
+{
+	struct sparseRow *source;
+	size_t n, i, k, column;
+
+	n = sparseCount;
+	work.count = n;
+	work.pivots = 0;
+	work.scratch = NULL;
+	work.scratchCapacity = 0;
+	work.rows = (struct sparseRow *) allocateMemory(n * sizeof(struct sparseRow));
+	work.columnRows = (struct sparseList *) allocateMemory(n * sizeof(struct sparseList));
+	work.columnCount = (size_t *) allocateMemory(n * sizeof(size_t));
+	work.bucketHead = (size_t *) allocateMemory((n+1) * sizeof(size_t));
+	work.bucketNext = (size_t *) allocateMemory(n * sizeof(size_t));
+	work.bucketPrevious = (size_t *) allocateMemory(n * sizeof(size_t));
+	work.pivotColumn = (size_t *) allocateMemory(n * sizeof(size_t));
+	work.order = (size_t *) allocateMemory(n * sizeof(size_t));
+
+	if(work.rows != NULL)
+		for(i=0; i<n; i++)
 		{
-			overFlow = 1;	/* Set Overflow Flag */
-			result.numerator = 0;
-			result.denominator = 0;
-			result.sign = 0;
-			return result;
+			work.rows[i].entry = NULL;
+			work.rows[i].count = work.rows[i].capacity = 0;
+			work.rows[i].rhs = sparseCoefficient[i].rhs;
+		}
+	if(work.columnRows != NULL)
+		for(i=0; i<n; i++)
+		{
+			work.columnRows[i].item = NULL;
+			work.columnRows[i].count = work.columnRows[i].capacity = 0;
 		}
 
-		overflowCheckWithSign = (num1OverflowCheckWithSign * fraction2.denominator) + (num2OverflowCheckWithSign * fraction1.denominator);
-		if((overflowCheckWithSign > INT32MAX) || (overflowCheckWithSign < INT32MIN))
+	if((work.rows == NULL) || (work.columnRows == NULL) || (work.columnCount == NULL) ||
+		(work.bucketHead == NULL) || (work.bucketNext == NULL) || (work.bucketPrevious == NULL) ||
+		(work.pivotColumn == NULL) || (work.order == NULL))
+		return 0;
+
+	for(i=0; i<n; i++)
+	{
+		work.columnCount[i] = 0;
+		work.bucketHead[i] = n;	/* Empty Bucket */
+		work.pivotColumn[i] = n;	/* Active */
+	}
+	work.bucketHead[n] = n;
+
+	/* Copy Rows, Note Which Rows Hold Each Column */
+	for(i=0; i<n; i++)
+	{
+		source = &sparseCoefficient[i];
+		if(source->count != 0)
 		{
-			overFlow = 1;	/* Set Overflow Flag */
-			result.numerator = 0;
-			result.denominator = 0;
-			result.sign = 0;
-			return result;
+			if(!reserveSparseRow(work.rows[i], source->count))
+				return 0;
+			memcpy(work.rows[i].entry, source->entry, source->count * sizeof(struct sparseEntry));
+			work.rows[i].count = source->count;
 		}
 
-		/* Drop Down To Signed 32-bit Representation, Lose 1 Bit Of Size */
-		if(fraction1.sign == 1)
-			num1 = fraction1.numerator * -1;
-		else
-			num1 = fraction1.numerator;
-		if(fraction2.sign == 1)
-			num2 = fraction2.numerator * -1;
-		else
-			num2 = fraction2.numerator;
+		for(k=0; k<source->count; k++)
+		{
+			column = source->entry[k].column;
+			work.columnCount[column]++;
+			if(!appendSparseList(work.columnRows[column], i))
+				return 0;
+		}
 
-		resultNum = (num1 * fraction2.denominator) + (num2 * fraction1.denominator);
-		if(resultNum < 0)
-			result.sign = 1;
+		insertSparseBucket(work, i);
+	}
+
+	return 1;
+}
+
+/*	The purpose of this function is to deallocate the workspace of
+	solveSparse().
+
+	Parameters: 
+		work - workspace set up by createSparseWork()
+
+	Returns:
+		None
+*/
+void eqsolver::releaseSparseWork(struct sparseWork &work)
+{
+	size_t i;
+
+	if(work.rows != NULL)
+	{
+		for(i=0; i<work.count; i++)
+			if(work.rows[i].entry != NULL)
+				releaseMemory(work.rows[i].entry);
+		releaseMemory(work.rows);
+	}
+	if(work.columnRows != NULL)
+	{
+		for(i=0; i<work.count; i++)
+			if(work.columnRows[i].item != NULL)
+				releaseMemory(work.columnRows[i].item);
+		releaseMemory(work.columnRows);
+	}
+	if(work.columnCount != NULL)
+		releaseMemory(work.columnCount);
+	if(work.bucketHead != NULL)
+		releaseMemory(work.bucketHead);
+	if(work.bucketNext != NULL)
+		releaseMemory(work.bucketNext);
+	if(work.bucketPrevious != NULL)
+		releaseMemory(work.bucketPrevious);
+	if(work.pivotColumn != NULL)
+		releaseMemory(work.pivotColumn);
+	if(work.order != NULL)
+		releaseMemory(work.order);
+	if(work.scratch != NULL)
+		releaseMemory(work.scratch);
+}
+
+/*	The purpose of this function is to reduce the sparse working copy
+	to triangular form (in pivot order). Active equations are kept in
+	buckets by their number of nonzeros, so the sparsest is found
+	without a search: an empty one is dropped (or shows the system has
+	no solutions), any other supplies the next pivot.
+
+	Parameters: 
+		work - workspace set up by createSparseWork()
+
+	Returns:
+		SOLVED if every unknown received a pivot, INFINITE_SOLUTIONS if
+		some did not, NO_SOLUTIONS, MEMORY_ERROR or OVERFLOW.
+*/
+unsigned int eqsolver::eliminateSparse(struct sparseWork &work)
+{
+	struct sparseRow *pivotPtr;
+	struct sparseList *list;
+	size_t n, minimum, row, other, column, best, k, position;
+
+	n = work.count;
+	minimum = 0;
+
+	while(1)
+	{
+		/* Active Equation With The Fewest Nonzeros */
+		while((minimum <= n) && (work.bucketHead[minimum] == n))
+			minimum++;
+		if(minimum > n)
+			break;	/* None Left */
+
+		row = work.bucketHead[minimum];
+		removeSparseBucket(work, row);
+		pivotPtr = &work.rows[row];
+
+		/* 0 = RHS: Redundant, Unless The RHS Is Not 0 */
+		if(pivotPtr->count == 0)
+		{
+			work.pivotColumn[row] = n+1;	/* Dropped */
+			if(pivotPtr->rhs.numerator != 0)
+				return NO_SOLUTIONS;
+			continue;
+		}
+
+		/* Pivot On The Unknown Held By The Fewest Other Equations */
+		best = 0;
+		for(k=1; k<pivotPtr->count; k++)
+			if(work.columnCount[pivotPtr->entry[k].column] < work.columnCount[pivotPtr->entry[best].column])
+				best = k;
+		column = pivotPtr->entry[best].column;
+
+		work.pivotColumn[row] = column;
+		work.order[work.pivots++] = row;
+
+		/* Pivot Equation Leaves The Active Set */
+		for(k=0; k<pivotPtr->count; k++)
+			work.columnCount[pivotPtr->entry[k].column]--;
+
+		/* Eliminate The Unknown From The Active Equations Holding It */
+		list = &work.columnRows[column];
+		for(k=0; k<list->count; k++)
+		{
+			other = list->item[k];
+			if(work.pivotColumn[other] != n)
+				continue;	/* Pivot Or Dropped */
+
+			position = findSparseColumn(work.rows[other], column);
+			if((position >= work.rows[other].count) || (work.rows[other].entry[position].column != column))
+				continue;	/* Since Cancelled Out */
+
+			removeSparseBucket(work, other);
+			if(!eliminateSparseRow(work, other, position, row, best))
+				return MEMORY_ERROR;
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+			insertSparseBucket(work, other);
+
+			if(work.rows[other].count < minimum)
+				minimum = work.rows[other].count;
+		}
+
+		/* Column Is Done With */
+		if(list->item != NULL)
+			releaseMemory(list->item);
+		list->item = NULL;
+		list->count = list->capacity = 0;
+	}
+
+	sparseRank = work.pivots;
+
+	return (work.pivots == n) ? SOLVED : INFINITE_SOLUTIONS;
+}
+
+/*	The purpose of this function is to subtract the multiple of the
+	pivot equation which clears the pivot unknown from another active
+	equation. Both are merged in column order into the scratch row,
+	keeping columnCount & columnRows up to date as coefficients fill
+	in or cancel out.
+
+	Parameters: 
+		work - workspace set up by createSparseWork()
+		row - equation to reduce
+		position - entry of row holding the pivot column
+		pivotRow - pivot equation
+		pivotPosition - entry of pivotRow holding the pivot column
+
+	Returns:
+		1 on success (check overFlow), 0 on memory allocation errors.
+*/
+int eqsolver::eliminateSparseRow(struct sparseWork &work, size_t row, size_t position, size_t pivotRow, size_t pivotPosition)
+{
+	struct sparseRow *rowPtr, *pivotPtr;
+	struct sparseEntry *scratch;
+	struct fraction multiplier, value;
+	size_t i, j, count, capacity, column;
+
+	rowPtr = &work.rows[row];
+	pivotPtr = &work.rows[pivotRow];
+
+	multiplier = divide(rowPtr->entry[position].value, pivotPtr->entry[pivotPosition].value);
+	if(overFlow) return 1;
+
+	/* Room For Every Column Of Both */
+	capacity = rowPtr->count + pivotPtr->count;
+	if(capacity > work.scratchCapacity)
+	{
+		scratch = (struct sparseEntry *) reallocateMemory(work.scratch, capacity * sizeof(struct sparseEntry));
+		if(scratch == NULL)
+			return 0;
+		work.scratch = scratch;
+		work.scratchCapacity = capacity;
+	}
+	scratch = work.scratch;
+
+	i = j = count = 0;
+	while((i < rowPtr->count) || (j < pivotPtr->count))
+	{
+		/* Column Only In row, Unchanged */
+		if((j == pivotPtr->count) || ((i < rowPtr->count) && (rowPtr->entry[i].column < pivotPtr->entry[j].column)))
+		{
+			scratch[count++] = rowPtr->entry[i++];
+			continue;
+		}
+
+		column = pivotPtr->entry[j].column;
+
+		/* Column Only In pivotRow: Fill-In */
+		if((i == rowPtr->count) || (column < rowPtr->entry[i].column))
+		{
+			value = multiply(multiplier, pivotPtr->entry[j].value);
+			if(overFlow) return 1;
+			value.sign = (value.sign == 1) ? 0 : 1;
+			j++;
+
+			work.columnCount[column]++;
+			if(!appendSparseList(work.columnRows[column], row))
+				return 0;
+			scratch[count].column = column;
+			scratch[count++].value = value;
+			continue;
+		}
+
+		/* Column In Both */
+		if(j == pivotPosition)
+			value.numerator = 0;	/* Pivot Column, Cleared Exactly */
 		else
-			result.sign = 0;
+		{
+			value = subtract(rowPtr->entry[i].value, multiply(multiplier, pivotPtr->entry[j].value));
+			if(overFlow) return 1;
+		}
+		i++;
+		j++;
 
-		result.numerator = abs(resultNum);
+		if(value.numerator == 0)
+		{
+			work.columnCount[column]--;	/* Cancelled Out */
+			continue;
+		}
+		scratch[count].column = column;
+		scratch[count++].value = value;
 	}
 
-	/* Set Denominator */
-	overflowCheck = (UINT64)fraction1.denominator * (UINT64)fraction2.denominator;
-	if(overflowCheck > UINT32MAX)
+	rowPtr->rhs = subtract(rowPtr->rhs, multiply(multiplier, pivotPtr->rhs));
+	if(overFlow) return 1;
+
+	if(!reserveSparseRow(*rowPtr, count))
+		return 0;
+	memcpy(rowPtr->entry, scratch, count * sizeof(struct sparseEntry));
+	rowPtr->count = count;
+
+	return 1;
+}
+
+/*	The purpose of this function is to back substitute the triangular
+	form left by eliminateSparse(), last pivot first. Each pivot
+	equation only holds unknowns pivoted after it, or without a pivot
+	(left at 0).
+
+	Parameters: 
+		work - workspace after eliminateSparse()
+		status - value to return on success
+
+	Returns:
+		status on success, OVERFLOW on 32-bit overflow.
+*/
+unsigned int eqsolver::substituteSparse(struct sparseWork &work, unsigned int status)
+{
+	struct sparseRow *rowPtr;
+	struct fraction sum, pivot, value;
+	size_t k, i, row, column;
+
+	pivot.numerator = pivot.denominator = 1;
+	pivot.sign = 0;
+
+	for(k=work.pivots; k>0; k--)
 	{
-		overFlow = 1;	/* Set Overflow Flag */
-		result.numerator = 0;
-		result.denominator = 0;
-		result.sign = 0;
-		return result;
+		row = work.order[(k-1)];
+		column = work.pivotColumn[row];
+		rowPtr = &work.rows[row];
+
+		sum = rowPtr->rhs;
+		for(i=0; i<rowPtr->count; i++)
+		{
+			if(rowPtr->entry[i].column == column)
+			{
+				pivot = rowPtr->entry[i].value;
+				continue;
+			}
+
+			value = sparseSolution[rowPtr->entry[i].column];
+			if(value.numerator == 0)
+				continue;
+			sum = subtract(sum, multiply(rowPtr->entry[i].value, value));
+			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
+		}
+
+		sparseSolution[column] = divide(sum, pivot);
+		if(overFlow) return OVERFLOW;
 	}
 
-	result.denominator = fraction1.denominator * fraction2.denominator;
+	return status;
+}
 
-	/* Prevent Divide By Zero (Should Not Happen If Called Properly) */
-	if((result.numerator != 0) && (result.denominator == 0))
-		return fraction1;	/* Return fraction1  Unaltered */
+/*	The purpose of this function is to check sparseSolution against
+	the sparse system as set, as verifySolution() does for the dense
+	one.
 
-	/* Reduce Result */
-	result = reduce(result);
+	Parameters: 
+		status - value to return if the solution checks out
 
-	return result;
+	Returns:
+		status if every equation is satisfied, NO_SOLUTIONS if one is
+		not, OVERFLOW on 32-bit Overflow.
+*/
+unsigned int eqsolver::verifySparse(unsigned int status)
+{
+	struct sparseRow *rowPtr;
+	struct fraction sum, value;
+	size_t i, k;
+
+	for(i=0; i<sparseCount; i++)
+	{
+		rowPtr = &sparseCoefficient[i];
+		sum.numerator = sum.denominator = 0;
+		sum.sign = 0;
+
+		for(k=0; k<rowPtr->count; k++)
+		{
+			value = sparseSolution[rowPtr->entry[k].column];
+			if(value.numerator == 0)
+				continue;
+			sum = add(sum, multiply(rowPtr->entry[k].value, value));
+			if(overFlow) return OVERFLOW;
+		}
+
+		value = subtract(sum, rowPtr->rhs);
+		if(overFlow) return OVERFLOW;
+		if(value.numerator != 0)
+			return NO_SOLUTIONS;
+	}
+
+	return status;
 }
 
-/*	The purpose of this function is to multiply a row in the specified 
-	matrix by the specified fraction value.
+/* Position Of column In A Sparse Row, Or Where It Would Be Inserted */
+size_t eqsolver::findSparseColumn(const struct sparseRow &row, size_t column)
+{
+	size_t low, high, middle;
+
+	low = 0;
+	high = row.count;
+	while(low < high)
+	{
+		middle = low + (high - low) / 2;
+		if(row.entry[middle].column < column)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+/* Grows A Sparse Row To Hold At Least capacity Entries, 1 On Success */
+int eqsolver::reserveSparseRow(struct sparseRow &row, size_t capacity)
+{
+	struct sparseEntry *entry;
+	size_t grown;
+
+	if(capacity <= row.capacity)
+		return 1;
+
+	grown = (row.capacity < 2) ? 4 : (row.capacity * 2);
+	if(grown < capacity)
+		grown = capacity;
+
+	entry = (struct sparseEntry *) reallocateMemory(row.entry, grown * sizeof(struct sparseEntry));
+	if(entry == NULL)
+		return 0;
+
+	row.entry = entry;
+	row.capacity = grown;
+
+	return 1;
+}
+
+/* Appends A Row # To A List, 1 On Success */
+int eqsolver::appendSparseList(struct sparseList &list, size_t item)
+{
+	size_t *grown;
+	size_t capacity;
+
+	if(list.count == list.capacity)
+	{
+		capacity = (list.capacity < 2) ? 4 : (list.capacity * 2);
+		grown = (size_t *) reallocateMemory(list.item, capacity * sizeof(size_t));
+		if(grown == NULL)
+			return 0;
+		list.item = grown;
+		list.capacity = capacity;
+	}
+
+	list.item[list.count++] = item;
+
+	return 1;
+}
+
+/* Links An Active Row Into The Bucket Of Its # Of Nonzeros */
+void eqsolver::insertSparseBucket(struct sparseWork &work, size_t row)
+{
+	size_t first;
+
+	first = work.bucketHead[work.rows[row].count];
+	work.bucketNext[row] = first;
+	work.bucketPrevious[row] = work.count;
+	if(first != work.count)
+		work.bucketPrevious[first] = row;
+	work.bucketHead[work.rows[row].count] = row;
+}
+
+/* Unlinks A Row From Its Bucket, Before Its # Of Nonzeros Changes */
+void eqsolver::removeSparseBucket(struct sparseWork &work, size_t row)
+{
+	if(work.bucketPrevious[row] != work.count)
+		work.bucketNext[work.bucketPrevious[row]] = work.bucketNext[row];
+	else
+		work.bucketHead[work.rows[row].count] = work.bucketNext[row];
+
+	if(work.bucketNext[row] != work.count)
+		work.bucketPrevious[work.bucketNext[row]] = work.bucketPrevious[row];
+}
+
+/*	The purpose of this function is to deallocate the sparse system
+	set up by setSparseSystem() and its solution.
 
 	Parameters: 
-		row - matrix row to be multiplied
-		multiplier - fraction value by which to multiply
-		coeffPtr - matrix to operate on
+		None
 
 	Returns:
-		Returns nothing. If row is out of bounds the function returns 
-		without altering any memory. 
+		None
 */
-void eqsolver::multiplyMatrixRow(unsigned short int row, struct fraction multiplier, struct fraction **coeffPtr)
+void eqsolver::releaseSparse(void)
 {
-	unsigned short int column;
-	
-	/* Perform Bounds Checking */
-	if((row < 1) || (row > eqCount))
-		return;	/* Out Of Bounds, Return */
+	size_t i;
 
-	/* Multiply Each Value In Specified Row By "multiplier" Fraction */
-	for(column=0; column<(eqCount+1); column++)
+	if(sparseCoefficient != NULL)
 	{
-		coeffPtr[(row-1)][column] = multiply(coeffPtr[(row-1)][column], multiplier);
-		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
+		for(i=0; i<sparseCount; i++)
+			if(sparseCoefficient[i].entry != NULL)
+				releaseMemory(sparseCoefficient[i].entry);
+		releaseMemory(sparseCoefficient);
 	}
+	if(sparseSolution != NULL)
+		releaseMemory(sparseSolution);
+
+	sparseCoefficient = NULL;
+	sparseSolution = NULL;
+	sparseCount = 0;
+	sparseRank = 0;
+}
+
+/*	The purpose of this function is to enable or disable the presolve
+	stage solveSystem() runs before the dense elimination (see
+	presolveSystem()). It is enabled by default.
+
+	Parameters: 
+		enable - 1 to enable, 0 to disable
+
+	Returns:
+		None
+*/
+void eqsolver::setPresolve(int enable)
+{
+	presolveEnabled = enable;
+}
+
+/*	The purpose of this function is to enable or disable the splitting
+	into independent subsystems solveSystem() tries before the dense
+	elimination (see componentSolve()). It is enabled by default.
+
+	Parameters: 
+		enable - 1 to enable, 0 to disable
+
+	Returns:
+		None
+*/
+void eqsolver::setComponentSolve(int enable)
+{
+	componentEnabled = enable;
+}
+
+/*	The purpose of this function is to enable or disable the band
+	detection solveSystem() runs on systems held in regular storage
+	(see bandSolve()). It is enabled by default.
+
+	Parameters: 
+		enable - 1 to enable, 0 to disable
+
+	Returns:
+		None
+*/
+void eqsolver::setBandSolve(int enable)
+{
+	bandEnabled = enable;
 }
 
-/*	The purpose of this function is to divide a row in the specified
-	matrix by the specified fraction value.
+/*	The purpose of this function is to enable or disable the block
+	triangular decomposition solveSystem() tries before the dense
+	elimination (see blockSolve()). It is enabled by default.
 
 	Parameters: 
-		row - matrix row to be divided
-		divisor - fraction value by which to divide
-		coeffPtr - matrix to operate on
+		enable - 1 to enable, 0 to disable
 
 	Returns:
-		Returns nothing. If row is out of bounds the function returns 
-		without altering any memory. 
+		None
 */
-void eqsolver::divideMatrixRow(unsigned short int row, struct fraction divisor, struct fraction **coeffPtr)
+void eqsolver::setBlockSolve(int enable)
 {
-	unsigned short int column;
-	
-	/* Perform Bounds Checking */
-	if((row < 1) || (row > eqCount))
-		return;	/* Out Of Bounds, Return */
-
-	/* Divide Each Value In Specified Row By "divisor" Fraction */
-	for(column=0; column<(eqCount+1); column++)
-	{
-		coeffPtr[(row-1)][column] = divide(coeffPtr[(row-1)][column], divisor);
-		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
-	}
+	blockEnabled = enable;
 }
 
-/*	The purpose of this function is to add a row to another row
-	in the specified matrix.
+/*	The purpose of this function is to enable or disable the tiled
+	elimination solveSystem() uses for large dense systems (see
+	tiledSolve()). It is enabled by default.
 
 	Parameters: 
-		row - matrix row to be added to
-		rowToAdd - matrix row to add
-		coeffPtr - matrix to operate on
+		enable - 1 to enable, 0 to disable
 
 	Returns:
-		Returns nothing. If row is out of bounds the function returns 
-		without altering any memory. 
+		None
 */
-void eqsolver::addMatrixRows(unsigned short int row, unsigned short int rowToAdd, struct fraction **coeffPtr)
+void eqsolver::setTiledSolve(int enable)
 {
-	unsigned short int column;
-	
-	/* Perform Bounds Checking */
-	if((row < 1) || (row > eqCount) || (rowToAdd < 1) || (rowToAdd > eqCount))
-		return;	/* Out Of Bounds, Return */
-
-	/* Add Each Value In Specified rowToAdd To row */
-	for(column=0; column<(eqCount+1); column++)
-	{
-		coeffPtr[(row-1)][column] = add(coeffPtr[(row-1)][column], coeffPtr[(rowToAdd-1)][column]);
-		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
-	}
+	tiledEnabled = enable;
 }
 
-/*	The purpose of this function is to swap the altered matrix
-	rows (this is used during the Gauss-Jordan algorithm). Since
-	the only memory locations altered are 2 pointers, this swap
-	method is extremely efficient. Note this is an overloaded version
-	of the private method swapRows().
+/*	The purpose of this function is to limit the number of threads
+	used to solve independent subsystems concurrently and to update
+	the tiles of large dense systems in parallel.
 
 	Parameters: 
-		row1, row2 - rows to swap
+		count - maximum # of threads, 0 = one per processor (default),
+				1 = no threads
 
 	Returns:
-		In case of error (out of bound matrix positioning), the
-		function simply returns without altering any memory.
+		None
 */
-void eqsolver::swapRows(unsigned short int row1, unsigned short int row2)
+void eqsolver::setThreadCount(unsigned int count)
 {
-	struct fraction *temp;	/* Swap Address Holder */
-
-	if((row1 < 1) || (row2 < 1) || (row1 > eqCount) || (row2 > eqCount))
-		return;	/* Out Of Bounds */
-
-	/* Swap Row Pointers */
-	temp = coefficient[(row1-1)];
-	coefficient[(row1-1)] = coefficient[(row2-1)];
-	coefficient[(row2-1)] = temp;
+	threadCount = count;
 }
 
-/*	The purpose of this function is to multiply a row in the altered
-	matrix by the specified fraction value. Note this is an overloaded
-	version of the private method multiplyMatrixRow().
+/*	The purpose of this function is to place the matrices of the next
+	setSystemEqCount() (original, working copy & solution) in
+	a single arena backed by huge pages instead of one allocation per
+	row, cutting TLB misses when elimination walks pivot columns of
+	large systems. Without reserved huge pages the arena is offered to
+	transparent huge pages (Linux); if it cannot be mapped at all,
+	rows are allocated as usual. cleanup() releases it as one unit.
 
 	Parameters: 
-		row - matrix row to be multiplied
-		multiplier - fraction value by which to multiply
+		enable - 1 = arena, 0 = one allocation per row (default)
 
 	Returns:
-		Returns nothing. If row is out of bounds the function returns 
-		without altering any memory. 
+		None
 */
-void eqsolver::multiplyMatrixRow(unsigned short int row, struct fraction multiplier)
+void eqsolver::setHugePages(int enable)
 {
-	unsigned short int column;
-	
-	/* Perform Bounds Checking */
-	if((row < 1) || (row > eqCount))
-		return;	/* Out Of Bounds, Return */
-
-	/* Multiply Each Value In Specified Row By "multiplier" Fraction */
-	for(column=0; column<(eqCount+1); column++)
-	{
-		coefficient[(row-1)][column] = multiply(coefficient[(row-1)][column], multiplier);
-		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
-	}
+	hugePagesEnabled = enable;
 }
 
-/*	The purpose of this function is to divide a row in the altered
-	matrix by the specified fraction value. Note this is an overloaded
-	version of the private method divideMatrixRow().
+/*	The purpose of this function is to choose how the next
+	setSystemEqCount() stores the "original" matrix. Compact storage
+	(the default) keeps each value as given to setCoefficient() or
+	setCoefficientFraction(), 2 bytes per value while all denominators
+	are 1 and 4 bytes once one is not, instead of a 12 byte fraction;
+	values are widened as solveSystem() copies them to its working
+	copy. Absorbing equations and updates (addEquation(),
+	updateCoefficient() ..) widen it for good. Out-of-core systems
+	keep fractions in the tile file regardless.
 
 	Parameters: 
-		row - matrix row to be divided
-		divisor - fraction value by which to divide
+		enable - 1 = compact storage (default), 0 = fractions
 
 	Returns:
-		Returns nothing. If row is out of bounds the function returns 
-		without altering any memory. 
+		None
 */
-void eqsolver::divideMatrixRow(unsigned short int row, struct fraction divisor)
+void eqsolver::setCompactStorage(int enable)
 {
-	unsigned short int column;
-	
-	/* Perform Bounds Checking */
-	if((row < 1) || (row > eqCount))
-		return;	/* Out Of Bounds, Return */
-
-	/* Divide Each Value In Specified Row By "divisor" Fraction */
-	for(column=0; column<(eqCount+1); column++)
-	{
-		coefficient[(row-1)][column] = divide(coefficient[(row-1)][column], divisor);
-		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
-	}
+	compactEnabled = enable;
 }
 
-/*	The purpose of this function is to add a row to another row
-	in the altered matrix. Note this is an overloaded version of 
-	the private method addMatrixRows().
+/*	The purpose of this function is to make solveSystem() save its
+	progress to a file every interval pivots, so a solve interrupted
+	by a deploy or preemption can be continued by resumeSystem().
+	Checkpointed solves go straight to Gauss-Jordan elimination
+	(presolve, decomposition & tiled elimination are skipped), whose
+	state between pivots is the working copy and pivot position. The
+	file holds two copies of the working copy, tile by tile, written
+	in turn so a crash while writing one leaves the other (it needs
+	twice the disk space of the matrix); each checkpoint rewrites only
+	the tiles changed since its copy was last written. Once the system
+	turns out singular no further checkpoints are taken. The file is
+	removed when the solve finishes.
 
 	Parameters: 
-		row - matrix row to be added to
-		rowToAdd - matrix row to add
+		path - checkpoint file, NULL to stop checkpointing (default)
+				The string must stay valid while solving.
+		interval - # of pivots between checkpoints, 0 = default
+				(CHECKPOINT_INTERVAL)
 
 	Returns:
-		Returns nothing. If row is out of bounds the function returns 
-		without altering any memory. 
+		None
 */
-void eqsolver::addMatrixRows(unsigned short int row, unsigned short int rowToAdd)
+void eqsolver::setCheckpoint(const char *path, unsigned int interval)
 {
-	unsigned short int column;
-	
-	/* Perform Bounds Checking */
-	if((row < 1) || (row > eqCount) || (rowToAdd < 1) || (rowToAdd > eqCount))
-		return;	/* Out Of Bounds, Return */
-
-	/* Add Each Value In Specified rowToAdd To row */
-	for(column=0; column<(eqCount+1); column++)
-	{
-		coefficient[(row-1)][column] = add(coefficient[(row-1)][column], coefficient[(rowToAdd-1)][column]);
-		if(overFlow) return;	/* Overflow Occurred, No Use To Continue */
-	}
+	checkpointPath = path;
+	checkpointInterval = (interval != 0) ? interval : CHECKPOINT_INTERVAL;
 }
 
-/*	The purpose of this function is to solve the system specified
-	in the "original" matrix coefficients.
+/*	The purpose of this function is to continue a solve from the file
+	set by setCheckpoint(). The system must have been set up again
+	exactly as before (it is checked against a fingerprint kept in the
+	file). Without a usable checkpoint the solve starts over, so this
+	may be called in place of solveSystem() whenever a checkpoint file
+	might exist.
 
 	Parameters: 
 		None
 
 	Returns:
-		Returns SOLVED, NO_SOLUTIONS, or INFINITE_SOLUTIONS.
-		If SOLVED, the solution coefficients can be located by
-		member variable solutionCoefficient. MEMORY_ERROR is returned
-		on allocation errors. Returns OVERFLOW on 32-bit Overflow.
+		Same as solveSystem().
 */
-unsigned int eqsolver::solveSystem(void)
+unsigned int eqsolver::resumeSystem(void)
 {
-	unsigned short int i, j;
-	unsigned short int row, column, nonZeroFound;
-	short int rowCounter;
-	struct fraction **coeffPtr;
-	struct fraction multiplier;
-	struct fraction solutionCheck;
-	
-	overFlow = 0;	/* Reset Overflow Flag */
-	
-	/* Create "Working Copy" Of Matrix To Solve */
-
-	coeffPtr = (struct fraction **) malloc(eqCount * sizeof(struct fraction *));
-	
-	if(coeffPtr == NULL)
-		return MEMORY_ERROR;
+	checkpointResume = (checkpointPath != NULL);
 
-	/* Allocate & Zero Initialize Row Coefficients */
-	for(i=0; i<eqCount; i++)
-	{
-		coeffPtr[i] = (struct fraction *) malloc((eqCount+1) * sizeof(struct fraction));
-	
-		/* Check For Memory Allocation Error */
-		if((coeffPtr[i] == NULL))
-			return MEMORY_ERROR;	/* Review Explanation Above */		
-	}
+	return solveSystem();
+}
 
-	/* Copy Matrix Coefficients From "original" Matrix To Working Copy */
-	for(i=0; i<eqCount; i++)
-		for(j=0; j<(eqCount+1); j++)
-			coeffPtr[i][j] = originalCoefficient[i][j];
+/*	The purpose of this function is to keep the matrices of the next
+	setSystemEqCount() (original, working copy & solution) in
+	a memory-mapped file on local disk instead of memory, for systems
+	too large for it. The operating system pages the file in and out;
+	solveSystem() eliminates it in panels as wide as memoryBudget
+	allows (see eliminationTileSize()) to keep passes over the disk
+	few, and skips presolve, component & block decomposition, which
+	copy subsystems into memory. Status codes are unchanged, MEMORY_ERROR
+	(setSystemEqCount() returning 0) includes failing to create the
+	file. The file is deleted as soon as it is mapped. Growing the
+	system (appendEquation()) moves it back to memory.
 
-	row = 0;
-	column = 0;
+	Parameters: 
+		path - file to create, NULL to keep matrices in memory (default)
+				The string must stay valid until setSystemEqCount().
+		memoryBudget - bytes of panels to keep in memory, 0 = default
+				(OUT_OF_CORE_BUDGET)
 
-	/* While Each Column Not Reduced */
-	while(column < eqCount)
-	{
-		/* If [row, column] = 0, Perform Full Pivoting */
-		if((coeffPtr[row][column].numerator == 0) &&
-			(coeffPtr[row][column].denominator == 0))
-		{
-			rowCounter = row+1;	/* Check For Replacement Below Only */
-			nonZeroFound = 0;	/* Set Flag */
+	Returns:
+		None
+*/
+void eqsolver::setOutOfCore(const char *path, UINT64 memoryBudget)
+{
+	outOfCorePath = path;
+	outOfCoreBudget = (memoryBudget != 0) ? memoryBudget : OUT_OF_CORE_BUDGET;
+}
 
-			while(!nonZeroFound)	/* While Suitable Pivot Not Found */
-			{
-				while(rowCounter < eqCount)	/* Process All Rows Below */
-				{
-					/* If Suitable Pivot Found, Swap Rows */
-					if((coeffPtr[rowCounter][column].numerator != 0) &&
-						(coeffPtr[rowCounter][column].denominator != 0))
-					{
-						swapRows((row+1), (rowCounter+1), coeffPtr);
-						nonZeroFound = 1;
-						break;
-					}
-					else	/* Proceed To Check Next Possible Pivot */
-						rowCounter = rowCounter+1;
-				}
+/*	The purpose of this function is to route every allocation of the
+	solver (matrices, solution, workspace of all solving stages and
+	scheduler, subsystem solvers) through an allocator of the caller,
+	e.g. an arena or pool, instead of malloc() / free(). The solver
+	serializes its calls to the allocator, threads or not. Blocks
+	carry a small header holding their size, which is also passed
+	back on release. The huge page arena (see setHugePages()) is
+	mapped from the operating system either way, but counted by
+	getMemoryUsage().
 
-				if(!nonZeroFound)	/* Ultimately Will Be Infinite Or No Solutions */
-				{
-					rowCounter = row+1;
-					column = column+1;	/* Skip Column, Goto Next */
-
-					if(column == eqCount) /* No Pivots Available? */
-					{
-						if((coeffPtr[row][column].numerator == 0) &&
-							(coeffPtr[row][column].denominator == 0))
-								return INFINITE_SOLUTIONS;
-						else	
-						{
-							/* First Check For A Row Of All Zeros, If One Exists, STILL INFINITE_SOLUTIONS */
-							/* row, column, & nonZeroFound Won't Be Used Anymore */
-							for(row=0; row<eqCount; row++)
-							{
-								nonZeroFound = 0;
-								for(column=0; column<=eqCount; column++)
-									if(coeffPtr[row][column].numerator != 0)
-										nonZeroFound = 1;
-								if(!nonZeroFound)
-									return INFINITE_SOLUTIONS;
-							}
-
-							return NO_SOLUTIONS;
-						}
-					}
-				}
-			}
-		}
-		
-		/* Is Pivot-Point = 1? If Not, Divide To Make It So */
-		if(!((coeffPtr[row][column].numerator == 1) && (coeffPtr[row][column].denominator == 1) && (coeffPtr[row][column].sign == 0)))
-		{	
-			divideMatrixRow((row+1), coeffPtr[row][column], coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-		}
+	Parameters: 
+		allocator - allocate & release functions and their context
+					(copied), NULL to go back to malloc() / free()
 
-		/* Make Pivot -1 */
-		for(i=0; i<=eqCount; i++)
-		{	
-			if((coeffPtr[(row)][i].numerator == 0) && (coeffPtr[(row)][i].denominator == 0))
-				continue;
-			
-			if(coeffPtr[(row)][i].sign == 0)
-				coeffPtr[(row)][i].sign = 1;
-			else
-				coeffPtr[(row)][i].sign = 0;
-		}
+	Returns:
+		1 on success
+		0 if the solver still holds memory (call cleanup() first),
+		nothing is changed then.
+*/
+int eqsolver::setAllocator(const struct memoryAllocator *allocator)
+{
+	if(ownAccount.inUse != 0)
+		return 0;
 
-		/* Clear Out Column Above Row */
-		for(rowCounter=row-1; rowCounter>=0; rowCounter--)
-		{
-			if((coeffPtr[rowCounter][column].numerator == 0) &&
-				(coeffPtr[rowCounter][column].denominator == 0))
-					continue;	/* Column Already Clear */
-			
-			multiplier = coeffPtr[rowCounter][column];
-			multiplyMatrixRow((row+1), multiplier, coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-			addMatrixRows((rowCounter+1), (row+1), coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-			divideMatrixRow((row+1), multiplier, coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-		}
+	if(allocator != NULL)
+		ownAccount.allocator = *allocator;
+	else
+	{
+		ownAccount.allocator.allocate = NULL;
+		ownAccount.allocator.release = NULL;
+		ownAccount.allocator.context = NULL;
+	}
 
-		/* Clear Out Column Below Row */
-		for(rowCounter=row+1; rowCounter<eqCount; rowCounter++)
-		{
-			if((coeffPtr[rowCounter][column].numerator == 0) &&
-				(coeffPtr[rowCounter][column].denominator == 0))
-					continue;	/* Column Already Clear */
-			
-			multiplier = coeffPtr[rowCounter][column];
-			multiplyMatrixRow((row+1), multiplier, coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-			addMatrixRows((rowCounter+1), (row+1), coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-			divideMatrixRow((row+1), multiplier, coeffPtr);
-			if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-		}
+	return 1;
+}
 
-		/* Make Pivot -1 */
-		for(i=0; i<=eqCount; i++)
-		{
-			if((coeffPtr[(row)][i].numerator == 0) && (coeffPtr[(row)][i].denominator == 0))
-				continue;
-			if(coeffPtr[(row)][i].sign == 0)
-				coeffPtr[(row)][i].sign = 1;
-			else
-				coeffPtr[(row)][i].sign = 0;
-		}
-		
-		/* Proceed To Next Pivot Point */
-		row++;	
-		column++;
-	}
+/*	The purpose of this function is to report the memory the solver
+	has allocated, subsystem solvers and allocator headers included.
+	Together with resetMemoryUsage() it measures single requests:
+	reset, call e.g. solveSystem(), read.
 
-	/* Perform Added "Checking" On Result */
-	if((coeffPtr[(eqCount-1)][(eqCount-1)].numerator == 0) &&
-		(coeffPtr[(eqCount-1)][(eqCount-1)].denominator == 0))
-	{
-		if((coeffPtr[(eqCount-1)][eqCount].numerator == 0) &&
-			(coeffPtr[(eqCount-1)][eqCount].denominator == 0))
-			return INFINITE_SOLUTIONS;
-		else
-			return NO_SOLUTIONS;
-	}
-	else
-	{
-		/* System IS In Reduced Echolon Form But The Solution
-			May Be Incorrect, Thus It Needs To Be Checked 
-			i = row, j = column */
+	Parameters: 
+		inUse - receives the bytes allocated now
+		peak - receives the most bytes allocated at once since the last
+				resetMemoryUsage()
+		allocations - receives the # of allocations since then
 
-		for(i=0; i<eqCount; i++)
-		{
-			solutionCheck.numerator = 0;
-			solutionCheck.denominator = 0;
-			
-			/* Total Row */
-			for(j=0; j<eqCount; j++)
-			{
-				solutionCheck = add(solutionCheck, multiply(originalCoefficient[i][j], coeffPtr[j][eqCount]));
-				if(overFlow) return OVERFLOW;	/* Overflow Occurred, No Reason To Continue */
-			}
+	Returns:
+		None
+*/
+void eqsolver::getMemoryUsage(UINT64 &inUse, UINT64 &peak, UINT64 &allocations)
+{
+	inUse = ownAccount.inUse;
+	peak = ownAccount.peak;
+	allocations = ownAccount.allocations;
+}
 
-			if((solutionCheck.numerator != originalCoefficient[i][eqCount].numerator) ||
-				(solutionCheck.denominator != originalCoefficient[i][eqCount].denominator) ||
-				(solutionCheck.sign != originalCoefficient[i][eqCount].sign))
-				return NO_SOLUTIONS;
-		}
-	}
+/*	The purpose of this function is to start measuring a new request:
+	the peak restarts from the bytes allocated now and the allocation
+	count from zero.
 
-	for(i=0; i<eqCount; i++)
-		solutionCoefficient[i] = coeffPtr[i][eqCount];
+	Parameters: 
+		None
 
-	return SOLVED;
+	Returns:
+		None
+*/
+void eqsolver::resetMemoryUsage(void)
+{
+	ownAccount.peak = ownAccount.inUse;
+	ownAccount.allocations = 0;
 }
 
 /*	The purpose of this function is to deallocate and "cleanup"
@@ -1084,11 +9445,30 @@ unsigned int eqsolver::solveSystem(void)
 */
 void eqsolver::cleanup(void)
 {
-	unsigned short int i;
+	unsigned int i;
 	
 	/* Deallocate Storage For solutionCoefficient */
-	if(solutionCoefficient != NULL)
-		free(solutionCoefficient);
+	if((solutionCoefficient != NULL) && !arenaOwns(solutionCoefficient))
+		releaseMemory(solutionCoefficient);
+
+	/* Deallocate Storage For Pivot Columns & Nullspace Basis */
+	releaseParametricSolution();
+	if(pivotColumn != NULL)
+		releaseMemory(pivotColumn);
+
+	/* Deallocate Inverse & Scratch Storage */
+	releaseFactorization();
+	releaseScratch();
+
+	/* Deallocate Band, Symmetric & Structured Storage */
+	if(bandCoefficient != NULL)
+		destroyMatrix(bandCoefficient);
+	if(symmetricCoefficient != NULL)
+		destroyMatrix(symmetricCoefficient);
+	if(structureGenerator != NULL)
+		releaseMemory(structureGenerator);
+	if(structureRHS != NULL)
+		releaseMemory(structureRHS);
 
 	/* Deallocate Storage For "coefficient" & "originalCoefficient"
 		matrix storages */
@@ -1096,24 +9476,44 @@ void eqsolver::cleanup(void)
 	{
 		/* Delete Rows */
 		for(i=0; i<eqCount; i++)
-			free(coefficient[i]);
+			if(!arenaOwns(coefficient[i]))
+				releaseMemory(coefficient[i]);
 		/* Delete Row Pointers */
-		free(coefficient);
+		releaseMemory(coefficient);
 	}
 	if(originalCoefficient != NULL)
 	{
 		/* Delete Rows */
 		for(i=0; i<eqCount; i++)
-			free(originalCoefficient[i]);
+			if(!arenaOwns(originalCoefficient[i]))
+				releaseMemory(originalCoefficient[i]);
 		/* Delete Row Pointers */
-		free(originalCoefficient);
+		releaseMemory(originalCoefficient);
 	}
+	if(compactNumerator != NULL)
+		releaseMemory(compactNumerator);
+	if(compactDenominator != NULL)
+		releaseMemory(compactDenominator);
+
+	/* Deallocate Sparse System */
+	releaseSparse();
+
+	/* Release The Huge Page Arena As One Unit */
+	releaseArena();
 
 	/* Reset eqCount to Zero, Reset Pointers To NULL */
 	eqCount = 0;
 	solutionCoefficient = NULL;
+	pivotColumn = NULL;
 	coefficient = NULL;
 	originalCoefficient = NULL;
+	compactNumerator = NULL;
+	compactDenominator = NULL;
+	bandCoefficient = NULL;
+	symmetricCoefficient = NULL;
+	structureGenerator = NULL;
+	structureRHS = NULL;
+	structureType = STRUCTURE_NONE;
 	overFlow = 0;
 
 	/* Done, Return */
@@ -9,6 +9,21 @@
 	- 100% integer arithmetic, no FPU needed
 	- Detects Infinite Solutions & No Solutions
 	- Detects Overflow
+	- Computes Determinant & Rank Using Fraction-Free Elimination
+	- Stores & Solves Banded Systems In O(N*Bandwidth^2)
+	- Stores Symmetric Systems As Upper Triangle, Solves Them By Fraction-Free LDL'
+	- Solves Toeplitz & Vandermonde Systems From Their Generators In O(N^2)
+	- Solves Independent Subsystems Concurrently
+	- Solves Reducible Systems Block By Block, Independent Blocks In Parallel
+	- Eliminates Large Dense Systems In Cache-Sized Tiles, Tiles In Parallel
+	- Optionally Keeps All Matrices In One Huge Page Arena
+	- Solves Systems Larger Than Memory Out Of Core, From A Memory-Mapped File
+	- Allocates Through A Pluggable Allocator, Accounts For Memory Used
+	- Checkpoints Long Solves, Resumes Them After Interruption
+	- Keeps The Unaltered Matrix In Its 16-bit Input Form
+	- Loads Whole Systems From Contiguous 16, 32 & 64-bit Arrays
+	- Takes 32 & 64-bit Integers & Fractions, Held In The Narrowest Form That Fits
+	- Stores & Solves Sparse Systems Of Millions Of Equations, 64-bit Indexed
 	
 	Requirements:
 	- The number of equations and unknowns submitted to the object
@@ -17,9 +32,13 @@
 	must be 100% integer-based; floating point calculation
 	IS NOT SUPPORTED in this module. 
 	- The maximum number of simulatenous equations (and thus unknowns)
-	this module supports is 65535.
+	this module supports is 65535, except in sparse storage
+	(setSparseSystem()), which is only limited by memory.
+	- GCC builds (GCC_BUILD defined) must link with -lpthread.
 */
 
+#include <stddef.h>
+
 /* 64-bit Integer Type Used In Overflow Checking */
 /* Different Compilers Use Different Mechanisms Of Representation */
 
@@ -27,17 +46,19 @@
 #ifdef GCC_BUILD	
 typedef unsigned long long int UINT64;
 typedef long long int INT64;
-#define UINT32MAX 42946972195LL
+#define UINT32MAX 4294967295LL
 #define INT32MAX 2147483647LL
 #define INT32MIN -2147483648LL
+#define INT64MAX 9223372036854775807LL
 
 /* Visual C++ 6.0 */
 #else
 typedef signed __int64 INT64;
 typedef unsigned __int64 UINT64;
-#define UINT32MAX 42946972195I64
+#define UINT32MAX 4294967295I64
 #define INT32MAX 2147483647I64
 #define INT32MIN -2147483648I64
+#define INT64MAX 9223372036854775807I64
 #endif
 
 /* Definitions */
@@ -51,20 +72,259 @@ typedef unsigned __int64 UINT64;
 to floating-point datatypes. */
 struct fraction
 {
-	unsigned int numerator;		/* Full 32-bits For 0-42946972195 */
+	unsigned int numerator;		/* Full 32-bits For 0-4294967295 */
 	unsigned int denominator;
 	unsigned int sign;	/* Holds Sign, Allows numerator & denominator Another Bit */
 						/* 1 = Negative 0 = Positive */
 };
 
+/* Memory Allocator Hook, See setAllocator(). Calls Are Serialized
+	By The Solver, So The Functions Need Not Be Thread-Safe */
+struct memoryAllocator
+{
+	void *(*allocate)(void *context, size_t size);	/* Returns NULL When Out Of Memory */
+	void (*release)(void *context, void *pointer, size_t size);	/* size As Passed To allocate */
+	void *context;	/* Handed To Both */
+};
+
+/* Memory Accounting, Shared By A Solver & The Subsystem Solvers It Creates */
+struct memoryAccount
+{
+	struct memoryAllocator allocator;	/* allocate == NULL: malloc() / free() */
+	UINT64 inUse;	/* Bytes Currently Allocated */
+	UINT64 peak;	/* Most Bytes Allocated At Once Since resetMemoryUsage() */
+	UINT64 allocations;	/* # Of Allocations Since resetMemoryUsage() */
+	void *lock;	/* Guards The Above While Threads Run, Else NULL */
+};
+
+/* Presolve Row & Column States */
+#define PRESOLVE_ACTIVE 0	/* Still Part Of The System */
+#define PRESOLVE_DROPPED 1	/* Zero Or Duplicate Row */
+#define PRESOLVE_FIXED 2	/* Row Singleton & The Unknown It Fixes */
+#define PRESOLVE_SUBSTITUTED 3	/* Column Singleton & Its Row, Back-Substituted */
+
+/* Tiled Elimination: Two 64 x 64 Tiles Of Fractions (96KB) Fit In L2 Cache */
+#define TILE_SIZE 64
+
+/* Structured Storage Types */
+#define STRUCTURE_NONE 0	/* No Structured Storage */
+#define STRUCTURE_TOEPLITZ 1	/* Constant Diagonals, Set Up By solveToeplitz() */
+#define STRUCTURE_VANDERMONDE 2	/* Powers Of Nodes, Set Up By solveVandermonde() */
+
+/* Out-Of-Core Mode: Memory Kept For The Panel Being Eliminated */
+#define OUT_OF_CORE_BUDGET 1073741824	/* 1GB */
+
+/* Checkpoints, See setCheckpoint() */
+#define CHECKPOINT_INTERVAL 256	/* Default # Of Pivots Between Checkpoints */
+#define CHECKPOINT_MAGIC 0x4B434A47	/* "GJCK" */
+#define CHECKPOINT_TIER 32	/* Arithmetic Of The Working Copy: 32-bit Fractions */
+
+/* Checkpoint Slot Header, Two At The Start Of The File (See checkpointOffset()) */
+struct checkpointHeader
+{
+	unsigned int magic;	/* CHECKPOINT_MAGIC */
+	unsigned int valid;	/* 0 While Tiles Are Being Written */
+	unsigned int sequence;	/* Checkpoint #, The Newer Slot Is Resumed */
+	unsigned int count;	/* # Of Equations */
+	unsigned int tileSize;	/* Rows & Columns Per Tile */
+	unsigned int row;	/* Next Pivot Row */
+	unsigned int column;	/* Next Pivot Column */
+	unsigned int tier;	/* CHECKPOINT_TIER */
+	unsigned int fingerprint;	/* Hash Of The "original" Matrix */
+};
+
+/* Huge Page Arena Regions, Each count x (count+1) Fractions Except The Last */
+#define ARENA_ORIGINAL 0	/* originalCoefficient Rows, Absent With Compact Storage */
+#define ARENA_WORKING 1	/* Working Copy Of solveSystem() */
+#define ARENA_SOLUTION 2	/* solutionCoefficient, count Fractions */
+
+/* Presolve Row Hash, Used To Find Duplicate Rows */
+struct presolveKey
+{
+	unsigned int hash;
+	unsigned int row;
+};
+
+/* Presolve Workspace, One Entry Per Row Or Column */
+struct presolveWork
+{
+	unsigned int *rowCount;	/* Nonzero Coefficients In Row */
+	unsigned int *columnCount;	/* Nonzero Coefficients In Column (Active Rows Only) */
+	unsigned int *columnRow;	/* Row Set Aside With A Column Singleton */
+	unsigned int *order;	/* Column Singletons In The Order Set Aside */
+	unsigned int orderCount;
+	unsigned int *columnMap;	/* Column Of Each Core Column */
+	unsigned char *rowState;	/* PRESOLVE_* */
+	unsigned char *columnState;	/* PRESOLVE_* */
+	struct presolveKey *keys;
+};
+
+class eqsolver;
+
+/* Independent Subsystems Of The System, Used By componentSolve() */
+struct componentWork
+{
+	unsigned int count;	/* # Of Equations */
+	struct fraction **coeffPtr;	/* System Being Solved */
+	struct fraction *solution;	/* Receives The Unknowns */
+	unsigned int *parent;	/* Union-Find Forest Over Columns */
+	unsigned int *columnComponent;	/* Component Holding Each Column */
+	unsigned int *rowComponent;	/* Component Holding Each Row, count If Row Is Zero */
+	unsigned int componentCount;
+	unsigned int *componentStart;	/* Component c Holds Columns componentColumn[componentStart[c]] .. componentColumn[componentStart[c+1]-1] */
+	unsigned int *componentColumn;
+	unsigned int *rowStart;	/* Component c Holds Rows componentRow[rowStart[c]] .. componentRow[rowStart[c+1]-1] */
+	unsigned int *componentRow;
+	unsigned int *componentStatus;	/* Result Of Solving Each Component */
+	eqsolver *solver;	/* eqsolver Of Each Component */
+};
+
+/* Block Triangular Form Of The System, Used By blockSolve() */
+struct blockWork
+{
+	unsigned int count;	/* # Of Equations */
+	struct fraction **coeffPtr;	/* System Being Solved */
+	struct fraction *solution;	/* Receives The Unknowns */
+	unsigned int *rowStart;	/* Row i Has Nonzero Columns rowColumn[rowStart[i]] .. rowColumn[rowStart[i+1]-1] */
+	unsigned int *rowColumn;
+	unsigned int *columnMatch;	/* Row Matched To Each Column */
+	unsigned int *columnBlock;	/* Block Holding Each Column */
+	unsigned int *columnPosition;	/* Position Of Each Column Within Its Block */
+	unsigned int blockCount;
+	unsigned int *blockStart;	/* Block b Holds Columns blockColumn[blockStart[b]] .. blockColumn[blockStart[b+1]-1] */
+	unsigned int *blockColumn;
+	unsigned int *blockLevel;	/* Blocks Only Depend On Blocks Of Lower Levels */
+	unsigned int *blockStatus;	/* Result Of Solving Each Block */
+	unsigned int *levelStart;	/* Level l Holds Blocks levelBlock[levelStart[l]] .. levelBlock[levelStart[l+1]-1] */
+	unsigned int *levelBlock;
+	unsigned int firstTask;	/* levelBlock Entry Of Task 0 In The Current Level */
+	int parallel;	/* 1 While The Current Level Runs Under runParallel() */
+	eqsolver *owner;	/* Solver Whose Settings Block Subsystems Inherit */
+	struct memoryAccount *account;	/* Charged By Block Subsystem Solvers */
+};
+
+/* Tiled Elimination Workspace */
+struct tileWork
+{
+	unsigned int count;	/* # Of Equations */
+	struct fraction **coeffPtr;	/* System Being Solved */
+	unsigned int tileSize;	/* Rows & Columns Per Tile */
+	unsigned int panelCount;	/* # Of Panels; Column Tile panelCount Holds The RHS */
+	unsigned int *pivotRow;	/* Row Swapped Into Each Pivot Position */
+	unsigned int *pivotEnd;	/* Pivots Found In Each Panel: Up To Its Last Column Unless Singular */
+	unsigned char *panelSkipped;	/* Panel Not Factored, An Earlier One Is Singular */
+	unsigned int *stepStart;	/* First Task # Of Each Step (panelCount+1 Entries) */
+	unsigned int *waiting;	/* # Of Unfinished Predecessors Of Each Task */
+	unsigned char *taskOverflow;	/* Overflow Flag Of Each Task */
+};
+
+/* Row Placement Workspace */
+struct placementWork
+{
+	unsigned int count;	/* # Of Equations */
+	unsigned int tileSize;	/* Rows Per Block */
+	struct fraction **rows;	/* Rows Being Allocated */
+	struct fraction **source;	/* Matrix Copied, NULL = Zeros */
+	const short int *numerator;	/* Compact Matrix Widened Into The Rows (See compactNumerator) When source Is NULL, Else NULL */
+	const short int *denominator;
+	struct fraction *block;	/* Rows Carved From Here (Stride count+1), NULL = malloc() Each Row */
+	struct memoryAccount *account;	/* Charged For Rows Not Carved From block */
+};
+
+/* Sparse Storage, See setSparseSystem(): One Nonzero Coefficient */
+struct sparseEntry
+{
+	size_t column;	/* Column # (Starting At 0) */
+	struct fraction value;
+};
+
+/* Sparse Storage: Nonzero Coefficients Of One Equation, In Column Order */
+struct sparseRow
+{
+	struct sparseEntry *entry;	/* count Entries, Room For capacity */
+	size_t count;
+	size_t capacity;
+	struct fraction rhs;	/* Right-Hand Side */
+};
+
+/* List Of Row #s, Grown As Needed */
+struct sparseList
+{
+	size_t *item;
+	size_t count;
+	size_t capacity;
+};
+
+/* Sparse Elimination Workspace, Used By solveSparse() */
+struct sparseWork
+{
+	size_t count;	/* # Of Equations */
+	struct sparseRow *rows;	/* Working Copy Of The Sparse System */
+	struct sparseList *columnRows;	/* Rows Each Column Was Stored Or Filled In (Some Since Cancelled Out) */
+	size_t *columnCount;	/* Active Rows Holding Each Column */
+	size_t *bucketHead;	/* First Active Row With Each # Of Nonzeros, count = None */
+	size_t *bucketNext;	/* Active Rows With The Same # Of Nonzeros, Doubly Linked */
+	size_t *bucketPrevious;
+	size_t *pivotColumn;	/* Pivot Column Of Each Row, count While Active, count+1 Once Dropped */
+	size_t *order;	/* Pivot Rows In Elimination Order */
+	size_t pivots;	/* # Of Entries In order */
+	struct sparseEntry *scratch;	/* Row Being Merged */
+	size_t scratchCapacity;
+};
+
 /* eqsolver Class Defintion */
 class eqsolver
 {	
 	/* Private Data */
 	
-	struct fraction **coefficient;	/* Holds N+1 x N Matrix Values On Which We May Operate */
-	struct fraction **originalCoefficient;	/* Unaltered Storage For Matrix Values */
+	struct fraction **coefficient;	/* Holds N+1 x N Matrix Values On Which We May Operate, NULL Until prepareAltered() */
+	struct fraction **originalCoefficient;	/* Unaltered Storage For Matrix Values, NULL While Held In Compact, Band, Symmetric Or Structured Storage */
+	short int *compactNumerator;	/* Unaltered Values As Given, Row By Row (Stride N+1), Set Up By setSystemEqCount(), Else NULL */
+	short int *compactDenominator;	/* Their Denominators, NULL While All Are 1 (Zeros 0) */
+	int compactEnabled;	/* 1 = setSystemEqCount() Keeps The "original" Matrix In Compact Storage */
 	unsigned short int eqCount;	/* # Of Simultaneous Equations In System */ 
+	unsigned short int *streamPivot;	/* Pivot Column Of Each Absorbed Equation (Starting At 0) */
+	struct fraction *streamScratch;	/* Holds Equation Being Absorbed */
+	unsigned int streamRank;	/* # Of Independent Equations Absorbed */
+	unsigned int streamStatus;	/* NO_SOLUTIONS Or OVERFLOW Once Absorbing Fails, Else 0 */
+	struct fraction **inverseCoefficient;	/* Inverse Of Matrix Kept By factorSystem(), Else NULL */
+	struct fraction *updateDelta;	/* Row Change (RHS Last) Applied By updateCoefficient() / updateRow() */
+	int presolveEnabled;	/* 1 = solveSystem() Runs presolveSystem() First */
+	struct fraction **bandCoefficient;	/* Band Storage (Diagonals -bandLower .. bandUpper, Then RHS) Set Up By setSystemBand(), Else NULL */
+	unsigned short int bandLower;	/* # Of Diagonals Below The Main Diagonal */
+	unsigned short int bandUpper;	/* # Of Diagonals Above The Main Diagonal */
+	struct fraction **symmetricCoefficient;	/* Upper Triangle (Row i: Columns i .. N-1, Then RHS) Set Up By setSystemSymmetric(), Else NULL */
+	int structureType;	/* STRUCTURE_TOEPLITZ Or STRUCTURE_VANDERMONDE When Held As Generators, Else STRUCTURE_NONE */
+	struct fraction *structureGenerator;	/* Toeplitz: t[-(N-1)] .. t[N-1], Vandermonde: N Nodes */
+	struct fraction *structureRHS;	/* RHS Of Structured System */
+	int bandEnabled;	/* 1 = solveSystem() Tries bandSolve() Before solveDense() */
+	int componentEnabled;	/* 1 = solveSystem() Tries componentSolve() Before solveDense() */
+	int blockEnabled;	/* 1 = solveSystem() Tries blockSolve() Before solveDense() */
+	int tiledEnabled;	/* 1 = solveSystem() Tries tiledSolve() Before solveDense() */
+	unsigned int tileSize;	/* Rows & Columns Per Tile, TILE_SIZE */
+	unsigned int threadCount;	/* Maximum # Of Threads, 0 = One Per Processor */
+	int hugePagesEnabled;	/* 1 = setSystemEqCount() Places Matrices In A Huge Page Arena */
+	struct fraction *arena;	/* Huge Page Arena (See ARENA_ORIGINAL ..), Else NULL */
+	UINT64 arenaSize;	/* Bytes Mapped */
+	unsigned int arenaCount;	/* eqCount The Arena Was Laid Out For */
+	int arenaFileBacked;	/* 1 = Arena Is The Tile File Of Out-Of-Core Mode */
+	int arenaOriginal;	/* 1 = Arena Has An ARENA_ORIGINAL Region (Not Needed With Compact Storage) */
+	const char *outOfCorePath;	/* Tile File For setSystemEqCount(), NULL = In Memory */
+	UINT64 outOfCoreBudget;	/* Bytes Of Panels To Keep In Memory */
+	const char *checkpointPath;	/* Checkpoint File, NULL = No Checkpoints */
+	unsigned int checkpointInterval;	/* # Of Pivots Between Checkpoints */
+	int checkpointResume;	/* 1 = Next solveSystem() Continues From checkpointPath */
+	void *checkpointFile;	/* Open Checkpoint File (FILE *) While Solving */
+	unsigned int *checkpointStamp;	/* # Of The First Checkpoint Holding Each Tile's Latest Change, NULL Unless Checkpointing */
+	unsigned int checkpointSequence;	/* # Of The Next Checkpoint */
+	unsigned int checkpointHeld[2];	/* # Of The Checkpoint In Each Slot, 0 = None */
+	unsigned int checkpointRowTiles;	/* Tiles Of The Working Copy, RHS Included */
+	unsigned int checkpointColumnTiles;
+	unsigned int checkpointFingerprint;	/* fingerprintSystem() Of The System Being Solved */
+	struct memoryAccount ownAccount;	/* Allocator & Usage Of This Solver */
+	struct memoryAccount *parentAccount;	/* Account Of The Solver This One Works For, Else NULL */
+	struct sparseRow *sparseCoefficient;	/* Sparse System Set Up By setSparseSystem(), Else NULL */
+	size_t sparseCount;	/* # Of Equations In Sparse System */
 
 	/* Private Methods */
 
@@ -76,6 +336,114 @@ class eqsolver
 	void multiplyMatrixRow(unsigned short int row, struct fraction multiplier, struct fraction **coeffPtr);	/* Multiply Specified Matrix Row By Value "multiplier" */
 	void divideMatrixRow(unsigned short int row, struct fraction divisor, struct fraction **coeffPtr);	/* Divide Specified Row By Value "divisor" */ 
 	void addMatrixRows(unsigned short int row, unsigned short int rowToAdd, struct fraction **coeffPtr);	/* Add "rowToAdd" to "row" in specified matrix */
+	UINT64 gcd64(UINT64 value1, UINT64 value2);	/* Greatest Common Factor Of 64-bit Values */
+	int multiply64(INT64 value1, INT64 value2, INT64 &result);	/* Overflow Checked 64-bit Multiply */
+	int subtract64(INT64 value1, INT64 value2, INT64 &result);	/* Overflow Checked 64-bit Subtract */
+	INT64 **createIntegerMatrix(INT64 *rowScale);	/* Scales "original" Matrix Rows (Minus RHS) To Integers */
+	void destroyIntegerMatrix(INT64 **intPtr);	/* Deallocates Integer Matrix */
+	unsigned short int fractionFreeEliminate(INT64 **intPtr, int stopOnDeficiency, unsigned int &rowSwaps);	/* Bareiss Elimination, Returns Rank */
+	unsigned int solveDense(struct fraction **coeffPtr, unsigned short int first);	/* Gauss-Jordan Elimination On Working Copy */
+	unsigned int checkpointSolve(struct fraction **coeffPtr, int resume);	/* solveDense() With Checkpoints */
+	unsigned int fingerprintSystem(void);	/* Hash Of "original" Matrix */
+	void markCheckpoint(unsigned int row, unsigned int column);	/* Row Changed From column On */
+	UINT64 checkpointOffset(unsigned int slot, unsigned int rowTile, unsigned int columnTile);	/* Tile Position In Checkpoint File */
+	void writeCheckpoint(struct fraction **coeffPtr, unsigned int next);	/* Writes Changed Tiles & Pivot Position */
+	int loadCheckpoint(struct fraction **coeffPtr, unsigned short int &first);	/* Reads Working Copy & Pivot Position */
+	unsigned int tiledSolve(struct fraction **coeffPtr);	/* Cache-Blocked Elimination On Working Copy */
+	unsigned int eliminationTileSize(void);	/* tileSize, Or Out-Of-Core Panel Width */
+	unsigned int eliminateTiles(struct tileWork &work);	/* Runs Tile Tasks On The Work-Stealing Scheduler */
+	static unsigned int tileTaskIndex(struct tileWork &work, unsigned int panel, unsigned int row, unsigned int column);	/* Task # Of A Tile Task */
+	static void decodeTileTask(struct tileWork &work, unsigned int index, unsigned int &panel, unsigned int &row, unsigned int &column);	/* Step & Tiles Of A Task # */
+	static int runTileTask(void *context, unsigned int index);	/* runGraph() Task */
+	static unsigned int tileSuccessors(void *context, unsigned int index, unsigned int *list);	/* runGraph() Successor List */
+	static unsigned int tileOwner(void *context, unsigned int index);	/* runGraph() Owner: Row Tile */
+	int placeRows(struct fraction **rows, struct fraction **source, struct fraction *block);	/* Allocates & Fills Rows, First Touch By Owning Worker */
+	int placeOriginal(struct fraction **rows, struct fraction *block);	/* placeRows() Copy Of The "original" Matrix, Any Dense Storage */
+	int runPlacement(struct placementWork &work);	/* Runs placeRowTask() Over All Row Blocks */
+	static void placeRowTask(void *context, unsigned int index);	/* runOwned() Task */
+	unsigned int factorPanel(struct tileWork &work, unsigned int first, unsigned int last);	/* Eliminates Within One Panel Of Columns */
+	void applySwaps(struct tileWork &work, unsigned int first, unsigned int last, unsigned int firstColumn, unsigned int lastColumn);	/* Row Swaps Of A Panel In Other Columns */
+	void updateTile(struct fraction **coeffPtr, unsigned int firstPivot, unsigned int lastPivot, unsigned int firstRow, unsigned int lastRow, unsigned int firstColumn, unsigned int lastColumn);	/* Applies Panel To One Tile */
+	unsigned int verifySolution(struct fraction *solution, unsigned int status);	/* Checks Solution Against originalCoefficient */
+	void subtractScaledRow(struct fraction *rowPtr, struct fraction *sourceRowPtr, struct fraction multiplier, unsigned int firstColumn, unsigned int lastColumn);	/* rowPtr -= multiplier * sourceRowPtr */
+	unsigned int finishReducedEchelon(struct fraction **coeffPtr, unsigned short int row);	/* Completes RREF Of Singular System */
+	void destroyMatrix(struct fraction **coeffPtr);	/* Deallocates Working Matrix */
+	int createArena(unsigned int count, int original);	/* Maps Huge Page Arena For count Equations */
+	struct fraction *arenaRegion(unsigned int region);	/* Start Of An Arena Region, NULL Without Arena */
+	int arenaOwns(void *pointer);	/* 1 = Pointer Lies In The Arena */
+	int leaveArena(void);	/* Moves Arena Contents To malloc() Storage, Releases Arena */
+	void releaseArena(void);	/* Unmaps Huge Page Arena */
+	struct memoryAccount *activeAccount(void);	/* parentAccount, Else ownAccount */
+	void *allocateMemory(size_t size);	/* malloc() Through The Allocator Hook */
+	void *reallocateMemory(void *pointer, size_t size);	/* realloc() Through The Allocator Hook */
+	void releaseMemory(void *pointer);	/* free() Through The Allocator Hook */
+	void releaseParametricSolution(void);	/* Deallocates nullspaceBasis */
+	struct fraction makeFraction(short int numerator, short int denominator);	/* Converts 16-bit Pair To Reduced Fraction */
+	int prepareStream(void);	/* Allocates Storage For Absorbing Equations */
+	void keepStreamEquation(void);	/* Copies Equation Into originalCoefficient */
+	unsigned int absorbEquation(void);	/* Adds Equation To Maintained Echelon Form */
+	struct fraction subtract(struct fraction fraction1, struct fraction fraction2);	/* Subtracts Fractions */
+	int prepareUpdate(void);	/* Allocates updateDelta */
+	unsigned int applyRowUpdate(unsigned short int row);	/* Sherman-Morrison Update Of Inverse & Solution */
+	void releaseFactorization(void);	/* Deallocates inverseCoefficient */
+	int growSystem(void);	/* Enlarges Storage For One More Equation & Unknown */
+	void shrinkSystem(unsigned int row, unsigned int column);	/* Removes An Equation & Unknown From Storage */
+	void releaseScratch(void);	/* Deallocates Storage Sized By eqCount */
+	unsigned int triangularSolve(void);	/* Substitution On Triangular Or Diagonal "original" Matrix */
+	unsigned int presolveSystem(struct fraction **coeffPtr);	/* Removes Singletons, Zero & Duplicate Rows */
+	unsigned int presolveReduce(struct fraction **coeffPtr, struct presolveWork &work);	/* Presolve Reductions */
+	unsigned int presolveCore(struct fraction **coeffPtr, struct presolveWork &work);	/* Solves Presolved Core, Merges Results */
+	void normalizeRow(struct fraction *rowPtr);	/* Divides Out Row Content, Makes First Coefficient Positive */
+	int sameCoefficients(struct fraction *values1, struct fraction *values2, unsigned int count);	/* Compares Fractions */
+	static int comparePresolveKeys(const void *key1, const void *key2);	/* qsort() Comparison */
+	void backSubstitute(struct fraction *rowPtr, unsigned int column, struct fraction *values, int useRHS);	/* Solves Equation For One Unknown */
+	int importNullspace(eqsolver &sub, const unsigned int *columnMap);	/* Appends Subsystem Nullspace Basis */
+	int reduceNullspace(void);	/* Merged Solutions To Reduced Row Echelon Form */
+	void inheritSettings(eqsolver &sub);	/* Passes solveSystem() Settings To A Nested eqsolver */
+	unsigned int componentSolve(struct fraction **coeffPtr);	/* Solves Independent Subsystems Separately */
+	unsigned int solveComponents(struct componentWork &work);	/* componentSolve() Once Workspace Is Allocated */
+	static void solveComponentTask(void *context, unsigned int index);	/* runParallel() Task */
+	struct fraction bandValue(unsigned int row, unsigned int column);	/* Reads Band Storage */
+	int storeValue(unsigned int row, unsigned int column, struct fraction value);	/* Writes Band, Symmetric Or Structured Storage */
+	struct fraction originalValue(unsigned int row, unsigned int column);	/* Reads "original" Matrix, Any Storage */
+	struct fraction compactValue(unsigned int row, unsigned int column);	/* Reads Compact Storage, Widened To A Fraction */
+	int storeCompact(unsigned int row, unsigned int column, short int numerator, short int denominator);	/* Writes Compact Storage */
+	int widenOriginal(void);	/* Converts Compact Storage To originalCoefficient */
+	void copyOriginal(struct fraction **coeffPtr);	/* Refills A Working Copy From The "original" Matrix */
+	int prepareLoad(int compact);	/* Readies Storage For A Bulk Load */
+	unsigned int loadIntegers(const int *values32, const INT64 *values64);	/* Bulk Load Of 32 / 64-bit Values */
+	unsigned int loadRationals(const int *numerators32, const int *denominators32, const INT64 *numerators64, const INT64 *denominators64);	/* Bulk Load Of 32 / 64-bit Fractions */
+	int reduceRational(INT64 numerator, INT64 denominator, struct fraction &value);	/* Lowest Terms, 0 If Beyond 32 Bits */
+	int prepareAltered(void);	/* Copies "original" Matrix To coefficient On First Use */
+	int expandStorage(void);	/* Converts Band, Symmetric Or Structured Storage To Regular Storage */
+	struct fraction **createBandWork(unsigned int lower, unsigned int upper);	/* Allocates Banded Working Copy */
+	unsigned int eliminateBand(struct fraction **workPtr, unsigned int lower, unsigned int upper);	/* Banded Elimination & Back Substitution */
+	unsigned int solveBandStorage(void);	/* Solves System Held In Band Storage */
+	unsigned int bandSolve(struct fraction **coeffPtr);	/* Detects Narrow Band, Solves It */
+	unsigned int solveSymmetricStorage(void);	/* Fraction-Free LDL' Solve Of System Held In Symmetric Storage */
+	int prepareStructure(unsigned short int count, unsigned int generatorCount);	/* Allocates Structured Storage */
+	struct fraction structuredValue(unsigned int row, unsigned int column);	/* Reads Structured Storage */
+	unsigned int levinsonSolve(void);	/* Levinson Recursion On Toeplitz Storage */
+	unsigned int bjorckPereyraSolve(void);	/* Bjorck-Pereyra On Vandermonde Storage */
+	unsigned int solveStructureStorage(void);	/* Solves System Held In Structured Storage */
+	unsigned int blockSolve(struct fraction **coeffPtr);	/* Solves Reducible System Block By Block */
+	unsigned int solveBlocks(struct blockWork &work);	/* blockSolve() Once Workspace Is Allocated */
+	unsigned int matchColumns(struct blockWork &work);	/* Pairs Each Column With A Row */
+	unsigned int findBlocks(struct blockWork &work);	/* Strongly Connected Components = Diagonal Blocks */
+	static void solveBlockTask(void *context, unsigned int index);	/* runParallel() Task */
+	void solveBlock(struct blockWork &work, unsigned int block);	/* Solves One Diagonal Block */
+	int createSparseWork(struct sparseWork &work);	/* Allocates solveSparse() Workspace, Copies System */
+	void releaseSparseWork(struct sparseWork &work);	/* Deallocates solveSparse() Workspace */
+	unsigned int eliminateSparse(struct sparseWork &work);	/* Sparse Gaussian Elimination, Fewest Nonzeros First */
+	int eliminateSparseRow(struct sparseWork &work, size_t row, size_t position, size_t pivotRow, size_t pivotPosition);	/* Clears Pivot Column From One Row */
+	unsigned int substituteSparse(struct sparseWork &work, unsigned int status);	/* Back Substitution Into sparseSolution */
+	unsigned int verifySparse(unsigned int status);	/* Checks sparseSolution Against The Sparse System */
+	size_t findSparseColumn(const struct sparseRow &row, size_t column);	/* Binary Search Of A Sparse Row */
+	int reserveSparseRow(struct sparseRow &row, size_t capacity);	/* Grows A Sparse Row */
+	int appendSparseList(struct sparseList &list, size_t item);	/* Grows A Row # List */
+	void insertSparseBucket(struct sparseWork &work, size_t row);	/* Files Row By # Of Nonzeros */
+	void removeSparseBucket(struct sparseWork &work, size_t row);	/* Unfiles Row */
+	void releaseSparse(void);	/* Deallocates Sparse System */
 
 public:
 
@@ -83,6 +451,12 @@ public:
 
 	int overFlow;	/* Overflow Flag To Be Used After Arithmetic Calculations 1 = Overflow 0 = No Overflow */
 	struct fraction *solutionCoefficient;	/* Holds Solution Coefficients After "solve()" Is Called */
+	unsigned short int *pivotColumn;	/* Pivot Column #s (Starting At 1) After "solve()" Returns SOLVED Or INFINITE_SOLUTIONS */
+	unsigned short int pivotCount;	/* # Of Entries In pivotColumn (The Rank) */
+	struct fraction **nullspaceBasis;	/* Holds nullity Vectors Spanning The Homogeneous Solutions After INFINITE_SOLUTIONS */
+	unsigned short int nullity;	/* # Of Vectors In nullspaceBasis */
+	struct fraction *sparseSolution;	/* Holds Sparse System Unknowns After "solveSparse()" Is Called */
+	size_t sparseRank;	/* # Of Pivots Found By "solveSparse()" */
 	
 	/* Public Methods */
 
@@ -91,14 +465,76 @@ public:
 	{
 		coefficient = NULL;
 		originalCoefficient = NULL;
+		compactNumerator = NULL;
+		compactDenominator = NULL;
+		compactEnabled = 1;
+		bandCoefficient = NULL;
+		symmetricCoefficient = NULL;
+		bandLower = bandUpper = 0;
+		structureType = STRUCTURE_NONE;
+		structureGenerator = NULL;
+		structureRHS = NULL;
 		solutionCoefficient = NULL;
+		pivotColumn = NULL;
+		nullspaceBasis = NULL;
+		pivotCount = nullity = 0;
+		inverseCoefficient = NULL;
+		updateDelta = NULL;
+		streamPivot = NULL;
+		streamScratch = NULL;
+		streamRank = streamStatus = 0;
+		presolveEnabled = 1;
+		bandEnabled = 1;
+		componentEnabled = 1;
+		blockEnabled = 1;
+		tiledEnabled = 1;
+		tileSize = TILE_SIZE;
+		threadCount = 0;
+		hugePagesEnabled = 0;
+		arena = NULL;
+		arenaSize = 0;
+		arenaCount = 0;
+		arenaFileBacked = 0;
+		arenaOriginal = 1;
+		outOfCorePath = NULL;
+		outOfCoreBudget = OUT_OF_CORE_BUDGET;
+		checkpointPath = NULL;
+		checkpointInterval = CHECKPOINT_INTERVAL;
+		checkpointResume = 0;
+		checkpointFile = NULL;
+		checkpointStamp = NULL;
+		checkpointSequence = 0;
+		checkpointHeld[0] = checkpointHeld[1] = 0;
+		checkpointRowTiles = checkpointColumnTiles = 0;
+		checkpointFingerprint = 0;
+		ownAccount.allocator.allocate = NULL;
+		ownAccount.allocator.release = NULL;
+		ownAccount.allocator.context = NULL;
+		ownAccount.inUse = ownAccount.peak = ownAccount.allocations = 0;
+		ownAccount.lock = NULL;
+		parentAccount = NULL;
+		sparseCoefficient = NULL;
+		sparseSolution = NULL;
+		sparseCount = sparseRank = 0;
 		eqCount = 0;
 		overFlow = 0;
 	}
 
 	unsigned int setSystemEqCount(unsigned short int count);	/* Sets Dimensions */
+	unsigned int setSystemBand(unsigned short int count, unsigned short int lower, unsigned short int upper);	/* Sets Dimensions, Stores Band Only */
+	unsigned int setSystemSymmetric(unsigned short int count);	/* Sets Dimensions, Stores Upper Triangle Only */
+	unsigned int solveToeplitz(unsigned short int count, const short int *firstColumn, const short int *firstRow, const short int *rhs);	/* O(N^2) Levinson Solve */
+	unsigned int solveVandermonde(unsigned short int count, const short int *nodes, const short int *rhs);	/* O(N^2) Bjorck-Pereyra Solve */
 	void setCoefficient(unsigned short int row, unsigned short int column, short int value);	/* Sets Coefficient Value */
 	void setCoefficientFraction(unsigned short int row, unsigned short int column, short int numerator, short int denominator);	/* Sets Coefficient Value In Fraction Form */
+	unsigned int setCoefficient64(unsigned short int row, unsigned short int column, INT64 value);	/* Same, 32 Or 64-bit Value */
+	unsigned int setCoefficientFraction64(unsigned short int row, unsigned short int column, INT64 numerator, INT64 denominator);	/* Same, 32 Or 64-bit Fraction Stored In Its Narrowest Form */
+	unsigned int setCoefficients(const short int *values);	/* Sets All Coefficients From A Row-Major Array (RHS Last In Each Row) */
+	unsigned int setCoefficients(const int *values);	/* Same, 32-bit Values */
+	unsigned int setCoefficients(const INT64 *values);	/* Same, 64-bit Values Within 32 Bits Of Magnitude */
+	unsigned int setCoefficientsFraction(const short int *numerators, const short int *denominators);	/* Same In Fraction Form */
+	unsigned int setCoefficientsFraction(const int *numerators, const int *denominators);	/* Same, 32-bit Fractions */
+	unsigned int setCoefficientsFraction(const INT64 *numerators, const INT64 *denominators);	/* Same, 64-bit Fractions Reduced To Fit */
 	int getOriginalMatrixCoefficient(unsigned short int row, unsigned short int column);	/* Retrives Unaltered Matrix Coefficient */
 	void getAlteredMatrixCoefficient(unsigned short int row, unsigned short int column, struct fraction &coefficientValue);	/* Retrieves Altered Matrix Coefficient */
 	void getOriginalMatrixCoefficientFraction(unsigned int row, unsigned short int column, int *numerator, int *denominator);
@@ -107,5 +543,31 @@ public:
 	void divideMatrixRow(unsigned short int row, struct fraction divisor);	/* Divide Specified Row By Value "divisor" */ 
 	void addMatrixRows(unsigned short int row, unsigned short int rowToAdd);	/* Add "rowToAdd" To "row" In Altered Matrix */
 	unsigned int solveSystem(void);	/* Solves System Specified In originalCoefficient, Places Solution In solutionCoefficient Array */
+	unsigned int determinant(struct fraction &determinantValue);	/* Determinant Of Unaltered Matrix (RHS Ignored) */
+	unsigned int rank(unsigned short int &rankValue);	/* Rank Of Unaltered Matrix (RHS Ignored) */
+	unsigned int addEquation(const short int *values);	/* Absorbs One Equation (eqCount+1 Values, RHS Last) */
+	unsigned int addEquationFraction(const short int *numerators, const short int *denominators);	/* Same In Fraction Form */
+	unsigned int factorSystem(void);	/* Solves System & Keeps Inverse For Updates */
+	unsigned int updateCoefficient(unsigned short int row, unsigned short int column, short int value);	/* Changes Coefficient, Re-solves In O(N^2) */
+	unsigned int updateRow(unsigned short int row, const short int *values);	/* Replaces Equation, Re-solves In O(N^2) */
+	unsigned int appendEquation(const short int *rowValues, const short int *columnValues);	/* Adds Equation & Unknown, Re-solves In O(N^2) */
+	unsigned int removeEquation(unsigned short int row, unsigned short int column);	/* Removes Equation & Unknown, Re-solves In O(N^2) */
+	unsigned int setSparseSystem(size_t count);	/* Sets Dimensions Of A Sparse System, Beyond 65535 Equations */
+	unsigned int setSparseCoefficient(size_t row, size_t column, INT64 numerator, INT64 denominator);	/* Sets Sparse System Coefficient (Column count+1 = RHS) */
+	unsigned int solveSparse(void);	/* Sparse Elimination, Places Solution In sparseSolution */
+	void setPresolve(int enable);	/* Enables/Disables Presolve In solveSystem() */
+	void setBandSolve(int enable);	/* Enables/Disables Band Detection In solveSystem() */
+	void setComponentSolve(int enable);	/* Enables/Disables Splitting Into Independent Subsystems In solveSystem() */
+	void setBlockSolve(int enable);	/* Enables/Disables Block Triangular Decomposition In solveSystem() */
+	void setTiledSolve(int enable);	/* Enables/Disables Tiled Elimination Of Large Systems In solveSystem() */
+	void setThreadCount(unsigned int count);	/* Limits Threads, 0 = One Per Processor */
+	void setHugePages(int enable);	/* Enables/Disables Huge Page Arena For Matrices Of setSystemEqCount() */
+	void setCompactStorage(int enable);	/* Enables/Disables 16-bit Storage Of The "original" Matrix Of setSystemEqCount() */
+	void setCheckpoint(const char *path, unsigned int interval);	/* Checkpoints solveSystem() Every interval Pivots */
+	unsigned int resumeSystem(void);	/* solveSystem() Continuing From The Checkpoint */
+	void setOutOfCore(const char *path, UINT64 memoryBudget);	/* Keeps Matrices Of setSystemEqCount() In A Tile File On Disk */
+	int setAllocator(const struct memoryAllocator *allocator);	/* Routes All Allocations Through allocator, NULL = malloc() */
+	void getMemoryUsage(UINT64 &inUse, UINT64 &peak, UINT64 &allocations);	/* Bytes Allocated Now & At Most, # Of Allocations */
+	void resetMemoryUsage(void);	/* Starts A New Peak & Allocation Count */
 	void cleanup(void);	/* Deallocates Memory */
 };